@@ -1,24 +1,155 @@
 #include "MyMesh.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#if WITH_EDITOR
+#include "LevelEditorViewport.h"
+#endif
 
 AMyMeshActor::AMyMeshActor()
 {
 	
 	ProcMeshComponent = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("ProcMeshComponent"));
 	RootComponent = ProcMeshComponent;
+
+	// Only actors with a LOD chain need to tick, see UpdateLODTickEnabled. LOD switching doesn't
+	// need every frame, and a scene can hold one actor per SVG element.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickInterval = 0.1f;
 }
 
 void AMyMeshActor::BeginPlay()
 {
 	Super::BeginPlay();
-	
+	UpdateLODTickEnabled();
+}
+
+void AMyMeshActor::PostLoad()
+{
+	Super::PostLoad();
+
+	// Also covers PIE duplicates and cooked levels, which are loaded rather than spawned.
+	UpdateLODTickEnabled();
+}
+
+void AMyMeshActor::UpdateLODTickEnabled()
+{
+	const bool bHasLODChain = LODScreenSizes.Num() > 1;
+
+	// Picked up when the tick function is registered, for actors that aren't registered yet.
+	PrimaryActorTick.bStartWithTickEnabled = bHasLODChain;
+	SetActorTickEnabled(bHasLODChain);
 }
 
-void AMyMeshActor::CreateMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles)
+void AMyMeshActor::CreateMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FColor>& Colors)
 {
 	TArray<FVector> Normals;
 	Normals.Init(FVector(0.f, 0.f, 1.f), Vertices.Num());
 
-	ProcMeshComponent->CreateMeshSection(0, Vertices, Triangles, Normals, {}, {}, {}, true);
+	ProcMeshComponent->CreateMeshSection(0, Vertices, Triangles, Normals, {}, Colors, {}, true);
 }
 
+void AMyMeshActor::CreateMeshLOD(int32 LODIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FColor>& Colors, float ScreenSize)
+{
+	TArray<FVector> Normals;
+	Normals.Init(FVector(0.f, 0.f, 1.f), Vertices.Num());
+
+	// Collision comes from the full detail level only.
+	ProcMeshComponent->CreateMeshSection(LODIndex, Vertices, Triangles, Normals, {}, Colors, {}, LODIndex == 0);
+	ProcMeshComponent->SetMeshSectionVisible(LODIndex, LODIndex == CurrentLOD);
+
+	if (LODScreenSizes.Num() <= LODIndex)
+	{
+		LODScreenSizes.SetNumZeroed(LODIndex + 1);
+	}
+	LODScreenSizes[LODIndex] = ScreenSize;
 
+	UpdateLODTickEnabled();
+}
+
+void AMyMeshActor::SetMeshMaterial(UMaterialInterface* Material)
+{
+	for (int32 SectionIndex = 0; SectionIndex < ProcMeshComponent->GetNumSections(); SectionIndex++)
+	{
+		ProcMeshComponent->SetMaterial(SectionIndex, Material);
+	}
+}
+
+bool AMyMeshActor::ShouldTickIfViewportsOnly() const
+{
+	// LOD switching also has to follow the editor viewport camera.
+	return LODScreenSizes.Num() > 1;
+}
+
+void AMyMeshActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	const float ScreenSize = ComputeScreenSize();
+	if (ScreenSize < 0.f)
+	{
+		return;
+	}
+
+	// Same rule as static meshes: use the coarsest level whose threshold the screen size is still under.
+	int32 NewLOD = 0;
+	for (int32 LODIndex = LODScreenSizes.Num() - 1; LODIndex > 0; LODIndex--)
+	{
+		if (ScreenSize < LODScreenSizes[LODIndex])
+		{
+			NewLOD = LODIndex;
+			break;
+		}
+	}
+	SetCurrentLOD(NewLOD);
+}
+
+float AMyMeshActor::ComputeScreenSize() const
+{
+	FVector ViewLocation;
+	float FOVAngle = 90.f;
+	bool bHasView = false;
+
+	UWorld* World = GetWorld();
+	if (World && World->IsGameWorld())
+	{
+		APlayerController* PlayerController = World->GetFirstPlayerController();
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+			FOVAngle = PlayerController->PlayerCameraManager->GetFOVAngle();
+			bHasView = true;
+		}
+	}
+#if WITH_EDITOR
+	else if (GCurrentLevelEditingViewportClient)
+	{
+		ViewLocation = GCurrentLevelEditingViewportClient->GetViewLocation();
+		FOVAngle = GCurrentLevelEditingViewportClient->ViewFOV;
+		bHasView = true;
+	}
+#endif
+
+	if (!bHasView)
+	{
+		return -1.f;
+	}
+
+	// Matches ComputeBoundsScreenSize for a symmetric perspective projection.
+	const FBoxSphereBounds& Bounds = ProcMeshComponent->Bounds;
+	const float Distance = FMath::Max(FVector::Dist(Bounds.Origin, ViewLocation), 1.0f);
+	const float HalfFOVTan = FMath::Tan(FMath::DegreesToRadians(FOVAngle * 0.5f));
+	return Bounds.SphereRadius / (Distance * HalfFOVTan);
+}
+
+void AMyMeshActor::SetCurrentLOD(int32 LODIndex)
+{
+	if (LODIndex == CurrentLOD)
+	{
+		return;
+	}
+
+	ProcMeshComponent->SetMeshSectionVisible(CurrentLOD, false);
+	ProcMeshComponent->SetMeshSectionVisible(LODIndex, true);
+	CurrentLOD = LODIndex;
+}
@@ -13,10 +13,20 @@ class PUGINTOOL_API AMyMeshActor : public AActor
 public:
 	AMyMeshActor();
 
-	// Call this to create/update the mesh.
-	void CreateMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles);
+	// Call this to create/update the mesh. Colors holds one vertex colour per vertex.
+	void CreateMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FColor>& Colors);
 
+	// Call this to create/update one level of a LOD chain. Each level lives in its own
+	// mesh section and is shown while the actor's screen size is below ScreenSize.
+	void CreateMeshLOD(int32 LODIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FColor>& Colors, float ScreenSize);
 
+	// Applies one material to every section, so all LODs and colours share a single draw per section.
+	void SetMeshMaterial(UMaterialInterface* Material);
+
+	virtual void Tick(float DeltaSeconds) override;
+	virtual bool ShouldTickIfViewportsOnly() const override;
+
+	virtual void PostLoad() override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -24,4 +34,19 @@ protected:
 private:
 	UPROPERTY(VisibleAnywhere)
 	UProceduralMeshComponent* ProcMeshComponent;
+
+	// Screen size threshold per LOD section, in the same units as UStaticMesh LOD screen sizes.
+	UPROPERTY(VisibleAnywhere)
+	TArray<float> LODScreenSizes;
+
+	// Saved with the section visibility it matches, so a reloaded actor switches from the right level.
+	UPROPERTY()
+	int32 CurrentLOD = 0;
+
+	// Tick is not serialized, so this is re-applied whenever the actor is created, loaded or starts play.
+	void UpdateLODTickEnabled();
+
+	// Projected diameter of the bounds relative to the view, or -1 if there is no view to measure from.
+	float ComputeScreenSize() const;
+	void SetCurrentLOD(int32 LODIndex);
 };
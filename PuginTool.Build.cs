@@ -54,6 +54,11 @@ public class PuginTool : ModuleRules
 				"DesktopPlatform",
 				"ProceduralMeshComponent",
 				"XmlParser",
+				"MeshDescription",
+				"StaticMeshDescription",
+				"AssetTools",
+				"AssetRegistry",
+				"MaterialEditor",
 				// for file dialog api
 				// ... add private dependencies that you statically link with here ...	
 			}
@@ -3,6 +3,20 @@
 #include "CoreMinimal.h"
 #include "SVGElements.generated.h"
 
+enum class ESVGLineJoin : uint8
+{
+	Miter,
+	Round,
+	Bevel,
+};
+
+enum class ESVGLineCap : uint8
+{
+	Butt,
+	Round,
+	Square,
+};
+
 USTRUCT()
 struct FSVGElements
 {
@@ -19,6 +33,27 @@ struct FSVGElements
 
 	UPROPERTY()
 	TArray<int32> Triangles; // for triangulating the shape into renderable geometry
+
+	UPROPERTY()
+	FLinearColor FillColor = FLinearColor::Black; // resolved fill, linear with opacity in alpha
+
+	UPROPERTY()
+	bool bFilled = true; // false for fill="none"
+
+	UPROPERTY()
+	TArray<int32> ContourStarts; // first vertex of each boundary loop in Vertices, empty for a single loop
+
+	UPROPERTY()
+	FLinearColor StrokeColor = FLinearColor::Black; // resolved stroke, linear with opacity in alpha
+
+	UPROPERTY()
+	float StrokeWidth = 0.0f; // 0 for stroke="none"
+
+	UPROPERTY()
+	float StrokeMiterLimit = 4.0f;
+
+	ESVGLineJoin StrokeLineJoin = ESVGLineJoin::Miter;
+	ESVGLineCap StrokeLineCap = ESVGLineCap::Butt;
 	
 
 	FSVGElements() = default; // default constructor
@@ -0,0 +1,230 @@
+#include "SVGMeshCache.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static constexpr uint32 SVGMeshCacheMagic = 0x4D475653; // "SVGM"
+static constexpr int32 SVGMeshCacheVersion = 2;
+static constexpr float SVGQuantizedMax = 65535.0f;
+
+void FSVGCompactMesh::Encode(const FSVGMeshData& Mesh, ESVGPositionEncoding Encoding)
+{
+	PositionEncoding = Encoding;
+	Bounds = Mesh.GetBounds();
+	NumVertices = Mesh.Vertices.Num();
+	QuantizedPositions.Reset();
+	FullPositions.Reset();
+	Indices16.Reset();
+	Indices32.Reset();
+	Colors = Mesh.Colors;
+
+	if (PositionEncoding == ESVGPositionEncoding::Quantized16)
+	{
+		const FVector Extent = Bounds.GetSize();
+		QuantizedPositions.SetNumUninitialized(NumVertices * 3);
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const FVector Relative = Mesh.Vertices[i] - Bounds.Min;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				// Flat axes (the whole cap plane of a zero depth extrusion) collapse to 0.
+				const double Alpha = Extent[Axis] > UE_SMALL_NUMBER ? Relative[Axis] / Extent[Axis] : 0.0;
+				QuantizedPositions[i * 3 + Axis] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Alpha * SVGQuantizedMax), 0, 65535));
+			}
+		}
+	}
+	else
+	{
+		FullPositions.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			FullPositions[i] = FVector3f(Mesh.Vertices[i]);
+		}
+	}
+
+	if (NumVertices <= 65536)
+	{
+		Indices16.SetNumUninitialized(Mesh.Triangles.Num());
+		for (int32 i = 0; i < Mesh.Triangles.Num(); i++)
+		{
+			Indices16[i] = static_cast<uint16>(Mesh.Triangles[i]);
+		}
+	}
+	else
+	{
+		Indices32.SetNumUninitialized(Mesh.Triangles.Num());
+		for (int32 i = 0; i < Mesh.Triangles.Num(); i++)
+		{
+			Indices32[i] = static_cast<uint32>(Mesh.Triangles[i]);
+		}
+	}
+}
+
+bool FSVGCompactMesh::Decode(FSVGMeshData& OutMesh) const
+{
+	const bool bQuantized = PositionEncoding == ESVGPositionEncoding::Quantized16;
+	const int32 NumPositions = bQuantized ? QuantizedPositions.Num() / 3 : FullPositions.Num();
+	if (NumVertices < 0 || NumPositions != NumVertices || Colors.Num() != NumVertices)
+	{
+		return false;
+	}
+
+	OutMesh.Vertices.SetNumUninitialized(NumVertices);
+	if (bQuantized)
+	{
+		const FVector Extent = Bounds.GetSize();
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const FVector Alpha(
+				QuantizedPositions[i * 3] / SVGQuantizedMax,
+				QuantizedPositions[i * 3 + 1] / SVGQuantizedMax,
+				QuantizedPositions[i * 3 + 2] / SVGQuantizedMax);
+			OutMesh.Vertices[i] = Bounds.Min + Alpha * Extent;
+		}
+	}
+	else
+	{
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			OutMesh.Vertices[i] = FVector(FullPositions[i]);
+		}
+	}
+
+	OutMesh.Colors = Colors;
+
+	const int32 NumIndices = Indices16.Num() > 0 ? Indices16.Num() : Indices32.Num();
+	OutMesh.Triangles.SetNumUninitialized(NumIndices);
+	for (int32 i = 0; i < NumIndices; i++)
+	{
+		const uint32 Index = Indices16.Num() > 0 ? Indices16[i] : Indices32[i];
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+		OutMesh.Triangles[i] = static_cast<int32>(Index);
+	}
+	return true;
+}
+
+int64 FSVGCompactMesh::GetDataSize() const
+{
+	return QuantizedPositions.Num() * sizeof(uint16) + FullPositions.Num() * sizeof(FVector3f) + Colors.Num() * sizeof(FColor) +
+		Indices16.Num() * sizeof(uint16) + Indices32.Num() * sizeof(uint32);
+}
+
+FArchive& operator<<(FArchive& Ar, FSVGCompactMesh& Mesh)
+{
+	uint8 Encoding = static_cast<uint8>(Mesh.PositionEncoding);
+	Ar << Encoding;
+	Mesh.PositionEncoding = static_cast<ESVGPositionEncoding>(Encoding);
+
+	Ar << Mesh.Bounds.Min;
+	Ar << Mesh.Bounds.Max;
+	Mesh.Bounds.IsValid = 1;
+	Ar << Mesh.NumVertices;
+
+	if (Mesh.PositionEncoding == ESVGPositionEncoding::Quantized16)
+	{
+		Ar << Mesh.QuantizedPositions;
+	}
+	else
+	{
+		Ar << Mesh.FullPositions;
+	}
+
+	Ar << Mesh.Colors;
+
+	bool bIndices16 = Mesh.NumVertices <= 65536;
+	Ar << bIndices16;
+	if (bIndices16)
+	{
+		Ar << Mesh.Indices16;
+	}
+	else
+	{
+		Ar << Mesh.Indices32;
+	}
+	return Ar;
+}
+
+bool FSVGMeshCache::Save(const FString& FilePath, const TArray<FSVGMeshBatch>& Batches, ESVGPositionEncoding Encoding)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = SVGMeshCacheMagic;
+	int32 Version = SVGMeshCacheVersion;
+	int32 NumBatches = Batches.Num();
+	Writer << Magic << Version << NumBatches;
+
+	int64 RawSize = 0;
+	int64 CompactSize = 0;
+	for (const FSVGMeshBatch& Batch : Batches)
+	{
+		FString Name = Batch.Name;
+		FVector Origin = Batch.Origin;
+		bool bTile = Batch.bTile;
+		int32 NumLODs = Batch.LODs.Num();
+		Writer << Name << Origin << bTile << NumLODs;
+
+		for (const FSVGMeshData& LOD : Batch.LODs)
+		{
+			FSVGCompactMesh CompactMesh;
+			CompactMesh.Encode(LOD, Encoding);
+			Writer << CompactMesh;
+
+			RawSize += LOD.Vertices.Num() * sizeof(FVector) + LOD.Colors.Num() * sizeof(FColor) + LOD.Triangles.Num() * sizeof(int32);
+			CompactSize += CompactMesh.GetDataSize();
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Mesh cache geometry: %lld bytes encoded from %lld bytes."), CompactSize, RawSize);
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FSVGMeshCache::Load(const FString& FilePath, TArray<FSVGMeshBatch>& OutBatches)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to load mesh cache %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumBatches = 0;
+	Reader << Magic << Version << NumBatches;
+	if (Magic != SVGMeshCacheMagic || Version != SVGMeshCacheVersion || NumBatches < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Not a supported mesh cache file: %s"), *FilePath);
+		return false;
+	}
+
+	OutBatches.Reset();
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches && !Reader.IsError(); BatchIndex++)
+	{
+		FSVGMeshBatch& Batch = OutBatches.AddDefaulted_GetRef();
+		int32 NumLODs = 0;
+		Reader << Batch.Name << Batch.Origin << Batch.bTile << NumLODs;
+
+		for (int32 LODIndex = 0; LODIndex < NumLODs && !Reader.IsError(); LODIndex++)
+		{
+			FSVGCompactMesh CompactMesh;
+			Reader << CompactMesh;
+			if (!CompactMesh.Decode(Batch.LODs.AddDefaulted_GetRef()))
+			{
+				Reader.SetError();
+			}
+		}
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Mesh cache %s is truncated or corrupt."), *FilePath);
+		OutBatches.Reset();
+		return false;
+	}
+	return true;
+}
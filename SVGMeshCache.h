@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SVGMeshData.h"
+
+enum class ESVGPositionEncoding : uint8
+{
+	// 32-bit float per axis.
+	Float32,
+	// 16-bit unsigned per axis, relative to the mesh bounds.
+	Quantized16,
+};
+
+// Compact encoding of one FSVGMeshData for the mesh cache file. Indices drop to
+// 16 bits whenever the mesh has at most 65536 vertices. Normals are not stored,
+// they are rebuilt from the faces like every other consumer of FSVGMeshData does.
+struct FSVGCompactMesh
+{
+	ESVGPositionEncoding PositionEncoding = ESVGPositionEncoding::Quantized16;
+	FBox Bounds = FBox(ForceInit);
+	int32 NumVertices = 0;
+
+	// Only the array matching PositionEncoding is filled, 3 components per vertex for the quantized form.
+	TArray<uint16> QuantizedPositions;
+	TArray<FVector3f> FullPositions;
+
+	// Vertex colours are already 4 bytes each and are stored as they are.
+	TArray<FColor> Colors;
+
+	// Only one of the two index arrays is filled.
+	TArray<uint16> Indices16;
+	TArray<uint32> Indices32;
+
+	void Encode(const FSVGMeshData& Mesh, ESVGPositionEncoding Encoding);
+	// Returns false if the encoded arrays are inconsistent, as they can be in a corrupt file.
+	bool Decode(FSVGMeshData& OutMesh) const;
+
+	// Bytes taken by the encoded vertex and index data.
+	int64 GetDataSize() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FSVGCompactMesh& Mesh);
+};
+
+// Binary cache of generated batches, so a session can restore geometry without re-parsing and re-extruding.
+class FSVGMeshCache
+{
+public:
+	static bool Save(const FString& FilePath, const TArray<FSVGMeshBatch>& Batches, ESVGPositionEncoding Encoding);
+	static bool Load(const FString& FilePath, TArray<FSVGMeshBatch>& OutBatches);
+};
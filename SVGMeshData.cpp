@@ -0,0 +1,194 @@
+#include "SVGMeshData.h"
+
+int32 FSVGMeshData::WeldVertices()
+{
+	// Colour is part of the key so touching shapes with different fills keep their own vertices.
+	TMap<TPair<FIntVector, uint32>, int32> WeldedIndices;
+	WeldedIndices.Reserve(Vertices.Num());
+
+	TArray<FVector> WeldedVertices;
+	WeldedVertices.Reserve(Vertices.Num());
+	TArray<FColor> WeldedColors;
+	WeldedColors.Reserve(Colors.Num());
+	TArray<int32> Remap;
+	Remap.SetNumUninitialized(Vertices.Num());
+
+	for (int32 i = 0; i < Vertices.Num(); i++)
+	{
+		const FVector& Vertex = Vertices[i];
+		const FColor Color = Colors.IsValidIndex(i) ? Colors[i] : FColor::White;
+		const TPair<FIntVector, uint32> Key(FIntVector(
+			FMath::RoundToInt(Vertex.X * SVGSnapScale),
+			FMath::RoundToInt(Vertex.Y * SVGSnapScale),
+			FMath::RoundToInt(Vertex.Z * SVGSnapScale)), Color.DWColor());
+
+		if (const int32* Existing = WeldedIndices.Find(Key))
+		{
+			Remap[i] = *Existing;
+		}
+		else
+		{
+			Remap[i] = WeldedVertices.Add(Vertex);
+			WeldedColors.Add(Color);
+			WeldedIndices.Add(Key, Remap[i]);
+		}
+	}
+
+	TArray<int32> WeldedTriangles;
+	WeldedTriangles.Reserve(Triangles.Num());
+	for (int32 i = 0; i + 2 < Triangles.Num(); i += 3)
+	{
+		const int32 I0 = Remap[Triangles[i]];
+		const int32 I1 = Remap[Triangles[i + 1]];
+		const int32 I2 = Remap[Triangles[i + 2]];
+		if (I0 != I1 && I1 != I2 && I2 != I0)
+		{
+			WeldedTriangles.Append({ I0, I1, I2 });
+		}
+	}
+
+	const int32 NumRemoved = Vertices.Num() - WeldedVertices.Num();
+	Vertices = MoveTemp(WeldedVertices);
+	Colors = MoveTemp(WeldedColors);
+	Triangles = MoveTemp(WeldedTriangles);
+	return NumRemoved;
+}
+
+void FSVGOutline::Simplify(const TArray<FVector2D>& Outline, float Tolerance, TArray<FVector2D>& OutOutline)
+{
+	const int32 NumVertices = Outline.Num();
+	if (NumVertices <= 3 || Tolerance <= 0.f)
+	{
+		OutOutline = Outline;
+		return;
+	}
+
+	// Split the closed loop at vertex 0 and the vertex farthest from it, then simplify both chains.
+	int32 Farthest = 0;
+	double FarthestDistSq = -1.0;
+	for (int32 i = 1; i < NumVertices; i++)
+	{
+		const double DistSq = FVector2D::DistSquared(Outline[0], Outline[i]);
+		if (DistSq > FarthestDistSq)
+		{
+			FarthestDistSq = DistSq;
+			Farthest = i;
+		}
+	}
+
+	TArray<bool> Keep;
+	Keep.Init(false, NumVertices);
+	Keep[0] = true;
+	Keep[Farthest] = true;
+
+	// Spans are [Start, End] index pairs; End == NumVertices wraps back to vertex 0.
+	TArray<TPair<int32, int32>> Spans;
+	Spans.Emplace(0, Farthest);
+	Spans.Emplace(Farthest, NumVertices);
+
+	const double ToleranceSq = static_cast<double>(Tolerance) * Tolerance;
+	while (Spans.Num() > 0)
+	{
+		const TPair<int32, int32> Span = Spans.Pop();
+		const FVector2D& Start = Outline[Span.Key];
+		const FVector2D& End = Outline[Span.Value % NumVertices];
+
+		int32 Split = INDEX_NONE;
+		double SplitDistSq = ToleranceSq;
+		for (int32 i = Span.Key + 1; i < Span.Value; i++)
+		{
+			const double DistSq = FVector2D::DistSquared(Outline[i], FMath::ClosestPointOnSegment2D(Outline[i], Start, End));
+			if (DistSq > SplitDistSq)
+			{
+				SplitDistSq = DistSq;
+				Split = i;
+			}
+		}
+
+		if (Split != INDEX_NONE)
+		{
+			Keep[Split] = true;
+			Spans.Emplace(Span.Key, Split);
+			Spans.Emplace(Split, Span.Value);
+		}
+	}
+
+	int32 NumKept = 0;
+	for (bool bKeep : Keep)
+	{
+		NumKept += bKeep ? 1 : 0;
+	}
+
+	if (NumKept < 3)
+	{
+		// Both chains collapsed onto the split chord. Keep the vertex farthest from it, so the
+		// outline is the coarsest triangle rather than falling back to full detail.
+		int32 Apex = INDEX_NONE;
+		double ApexDistSq = -1.0;
+		for (int32 i = 1; i < NumVertices; i++)
+		{
+			const double DistSq = FVector2D::DistSquared(Outline[i], FMath::ClosestPointOnSegment2D(Outline[i], Outline[0], Outline[Farthest]));
+			if (!Keep[i] && DistSq > ApexDistSq)
+			{
+				ApexDistSq = DistSq;
+				Apex = i;
+			}
+		}
+		Keep[Apex] = true;
+	}
+
+	OutOutline.Reset();
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		if (Keep[i])
+		{
+			OutOutline.Add(Outline[i]);
+		}
+	}
+}
+
+void FSVGOutline::FindInternalEdges(const TArray<const TArray<FVector2D>*>& Outlines, TSet<FSVGEdgeKey>& OutInternalEdges)
+{
+	// Bit 1 is set when an edge runs in key order, bit 2 when it runs against it.
+	TMap<FSVGEdgeKey, uint8> EdgeDirections;
+
+	for (const TArray<FVector2D>* Outline : Outlines)
+	{
+		const int32 NumVertices = Outline->Num();
+		if (NumVertices < 3)
+		{
+			continue;
+		}
+
+		// Shoelace sign, so every outline is walked counterclockwise.
+		double TwiceArea = 0.0;
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const FVector2D& P = (*Outline)[i];
+			const FVector2D& Q = (*Outline)[(i + 1) % NumVertices];
+			TwiceArea += P.X * Q.Y - Q.X * P.Y;
+		}
+		const bool bReverse = TwiceArea < 0.0;
+
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const FIntPoint Start = FSVGEdgeKey::Snap((*Outline)[i]);
+			const FIntPoint End = FSVGEdgeKey::Snap((*Outline)[(i + 1) % NumVertices]);
+			if (Start == End)
+			{
+				continue;
+			}
+
+			const bool bInKeyOrder = FSVGEdgeKey::IsOrdered(Start, End) != bReverse;
+			EdgeDirections.FindOrAdd(FSVGEdgeKey((*Outline)[i], (*Outline)[(i + 1) % NumVertices])) |= bInKeyOrder ? 1 : 2;
+		}
+	}
+
+	for (const TPair<FSVGEdgeKey, uint8>& Edge : EdgeDirections)
+	{
+		if (Edge.Value == 3)
+		{
+			OutInternalEdges.Add(Edge.Key);
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Positions are snapped to 1/256 of a unit when matching coincident edges and vertices.
+static constexpr double SVGSnapScale = 256.0;
+
+// Vertex/index buffers for one extruded mesh, either a single SVG element or a batch of them.
+struct FSVGMeshData
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	// One per vertex, the fill colour in sRGB as authored in the SVG.
+	TArray<FColor> Colors;
+
+	bool IsEmpty() const { return Vertices.Num() == 0 || Triangles.Num() == 0; }
+
+	FBox GetBounds() const { return FBox(Vertices); }
+
+	// Appends another mesh, offsetting its indices past the vertices already held.
+	void Append(const FSVGMeshData& Other)
+	{
+		const int32 BaseIndex = Vertices.Num();
+		Vertices.Append(Other.Vertices);
+		Colors.Append(Other.Colors);
+		Triangles.Reserve(Triangles.Num() + Other.Triangles.Num());
+		for (int32 Index : Other.Triangles)
+		{
+			Triangles.Add(BaseIndex + Index);
+		}
+	}
+
+	// Moves every vertex by -Origin so the mesh can be placed with an actor transform at Origin.
+	void MakeRelativeTo(const FVector& Origin)
+	{
+		for (FVector& Vertex : Vertices)
+		{
+			Vertex -= Origin;
+		}
+	}
+
+	// Merges vertices with the same snapped position and colour, and drops triangles that collapse.
+	// Returns the number of vertices removed.
+	int32 WeldVertices();
+};
+
+// LOD meshes destined for one actor or asset, with vertices relative to Origin.
+struct FSVGMeshBatch
+{
+	FString Name;
+	FVector Origin = FVector::ZeroVector;
+	TArray<FSVGMeshData> LODs;
+
+	// Whether the batch is a grid tile rather than a single element.
+	bool bTile = false;
+
+	// Screen size below which a LOD level is used. Each level takes over once the
+	// mesh covers half the screen size of the previous one.
+	static float GetLODScreenSize(int32 LODIndex)
+	{
+		return FMath::Pow(0.5f, static_cast<float>(LODIndex));
+	}
+
+	// Re-expresses every LOD relative to a new origin without moving the geometry in the world.
+	void SetOrigin(const FVector& NewOrigin)
+	{
+		for (FSVGMeshData& LOD : LODs)
+		{
+			LOD.MakeRelativeTo(NewOrigin - Origin);
+		}
+		Origin = NewOrigin;
+	}
+};
+
+// Direction-independent key for an outline edge. Endpoints are snapped so edges that
+// coincide exactly between two elements hash to the same key.
+struct FSVGEdgeKey
+{
+	FIntPoint A;
+	FIntPoint B;
+
+	FSVGEdgeKey(const FVector2D& Start, const FVector2D& End)
+		: A(Snap(Start))
+		, B(Snap(End))
+	{
+		if (!IsOrdered(A, B))
+		{
+			Swap(A, B);
+		}
+	}
+
+	static FIntPoint Snap(const FVector2D& Point)
+	{
+		return FIntPoint(FMath::RoundToInt(Point.X * SVGSnapScale), FMath::RoundToInt(Point.Y * SVGSnapScale));
+	}
+
+	static bool IsOrdered(const FIntPoint& First, const FIntPoint& Second)
+	{
+		return First.X < Second.X || (First.X == Second.X && First.Y <= Second.Y);
+	}
+
+	bool operator==(const FSVGEdgeKey& Other) const { return A == Other.A && B == Other.B; }
+
+	friend uint32 GetTypeHash(const FSVGEdgeKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.A), GetTypeHash(Key.B));
+	}
+};
+
+// 2D outline helpers applied before triangulation and extrusion.
+struct FSVGOutline
+{
+	// Douglas-Peucker simplification of a closed outline. Vertices closer than Tolerance to the
+	// simplified edges are dropped. At least a triangle is always kept, so coarser tolerances never give more vertices.
+	static void Simplify(const TArray<FVector2D>& Outline, float Tolerance, TArray<FVector2D>& OutOutline);
+
+	// Finds edges that two outlines traverse in opposite directions once both are wound the
+	// same way, i.e. edges where two shapes touch side by side. Their extruded walls face each
+	// other and can never be seen. Overlapping shapes share edges in the same direction and are left alone.
+	static void FindInternalEdges(const TArray<const TArray<FVector2D>*>& Outlines, TSet<FSVGEdgeKey>& OutInternalEdges);
+};
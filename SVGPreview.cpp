@@ -0,0 +1,234 @@
+#include "SVGPreview.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/CoreStyle.h"
+
+// Share of the widget the framed bounds fill, leaving a margin around the shapes.
+static constexpr float SVGPreviewFill = 0.9f;
+// The wireframe is skipped past this many edges, where it would only paint the caps over.
+static constexpr int32 SVGPreviewMaxWireEdges = 65536;
+// Half the wireframe line width, in widget units.
+static constexpr float SVGPreviewWireHalfWidth = 0.5f;
+
+void SSVGPreview::Construct(const FArguments& InArgs)
+{
+	// Custom verts sample a texture, the plain white brush leaves the vertex colours as they are.
+	WhiteResource = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+}
+
+void SSVGPreview::ResetElements(int32 NumElements)
+{
+	Elements.Reset();
+	Elements.SetNum(NumElements);
+	SelectedElement = INDEX_NONE;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SSVGPreview::SetElementMesh(int32 ElementIndex, const TArray<const FSVGMeshData*>& Meshes)
+{
+	if (!Elements.IsValidIndex(ElementIndex))
+	{
+		return;
+	}
+
+	FPreviewElement& Element = Elements[ElementIndex];
+	Element = FPreviewElement();
+
+	TArray<int32> Remap;
+	for (const FSVGMeshData* Mesh : Meshes)
+	{
+		Element.NumMeshTriangles += Mesh->Triangles.Num() / 3;
+
+		// Extruded meshes hold their top cap vertices in the first half and the bottom cap in
+		// the second, so triangles using only the first half are the top cap. Walls mix both.
+		// Unlike a height test this still holds at zero extrusion depth, where both caps meet.
+		const int32 NumTopVertices = Mesh->Vertices.Num() / 2;
+
+		// Each mesh vertex gets at most one preview vertex, remapped as the kept triangles first use it.
+		Remap.Init(INDEX_NONE, NumTopVertices);
+		Element.Indices.Reserve(Element.Indices.Num() + Mesh->Triangles.Num());
+		for (int32 i = 0; i + 2 < Mesh->Triangles.Num(); i += 3)
+		{
+			const int32 Corners[3] = { Mesh->Triangles[i], Mesh->Triangles[i + 1], Mesh->Triangles[i + 2] };
+			if (Corners[0] >= NumTopVertices || Corners[1] >= NumTopVertices || Corners[2] >= NumTopVertices)
+			{
+				continue;
+			}
+
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const int32 MeshIndex = Corners[Corner];
+				if (Remap[MeshIndex] == INDEX_NONE)
+				{
+					Remap[MeshIndex] = Element.Positions.Num();
+					const FVector2f Position(Mesh->Vertices[MeshIndex].X, Mesh->Vertices[MeshIndex].Y);
+					Element.Positions.Add(Position);
+					Element.Colors.Add(Mesh->Colors.IsValidIndex(MeshIndex) ? Mesh->Colors[MeshIndex] : FColor::White);
+					Element.Bounds += Position;
+				}
+				Element.Indices.Add(static_cast<SlateIndex>(Remap[MeshIndex]));
+			}
+		}
+	}
+
+	// Triangles inside a cap share their edges, so each edge is kept once.
+	TSet<uint64> Edges;
+	Edges.Reserve(Element.Indices.Num());
+	Element.EdgeIndices.Reserve(Element.Indices.Num() * 2);
+	for (int32 i = 0; i + 2 < Element.Indices.Num(); i += 3)
+	{
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			const SlateIndex A = Element.Indices[i + Corner];
+			const SlateIndex B = Element.Indices[i + (Corner + 1) % 3];
+			bool bAlreadyInSet = false;
+			Edges.Add((static_cast<uint64>(FMath::Min(A, B)) << 32) | FMath::Max(A, B), &bAlreadyInSet);
+			if (!bAlreadyInSet)
+			{
+				Element.EdgeIndices.Append({ A, B });
+			}
+		}
+	}
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SSVGPreview::SetSelectedElement(int32 ElementIndex)
+{
+	SelectedElement = Elements.IsValidIndex(ElementIndex) ? ElementIndex : INDEX_NONE;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SSVGPreview::SetShowWireframe(bool bInShowWireframe)
+{
+	bShowWireframe = bInShowWireframe;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+FVector2D SSVGPreview::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D(256.0, 256.0);
+}
+
+int32 SSVGPreview::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), WhiteBrush, ESlateDrawEffect::None, FLinearColor(0.02f, 0.02f, 0.02f));
+
+	// Frame the selection, or everything when nothing is selected.
+	FBox2f ViewBounds(ForceInit);
+	int32 NumVertices = 0;
+	int32 NumIndices = 0;
+	int32 NumMeshTriangles = 0;
+	for (int32 ElementIndex = 0; ElementIndex < Elements.Num(); ElementIndex++)
+	{
+		const FPreviewElement& Element = Elements[ElementIndex];
+		if (SelectedElement == INDEX_NONE || SelectedElement == ElementIndex)
+		{
+			ViewBounds += Element.Bounds;
+		}
+		NumVertices += Element.Positions.Num();
+		NumIndices += Element.Indices.Num();
+		NumMeshTriangles += Element.NumMeshTriangles;
+	}
+
+	const FVector2f LocalSize(AllottedGeometry.GetLocalSize());
+	FVector2f ViewOffset = LocalSize * 0.5f;
+	float ViewScale = 1.0f;
+	if (ViewBounds.bIsValid)
+	{
+		// SVG and Slate both grow y downwards, so the view is a uniform scale and offset.
+		const FVector2f ViewSize = ViewBounds.GetSize();
+		ViewScale = SVGPreviewFill * FMath::Min(LocalSize.X / FMath::Max(ViewSize.X, UE_KINDA_SMALL_NUMBER), LocalSize.Y / FMath::Max(ViewSize.Y, UE_KINDA_SMALL_NUMBER));
+		ViewOffset -= ViewBounds.GetCenter() * ViewScale;
+	}
+
+	// All caps go out as one custom vertex batch, in element order like the SVG paints them.
+	const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+	BatchVertices.Reset(NumVertices);
+	BatchIndices.Reset(NumIndices);
+	for (int32 ElementIndex = 0; ElementIndex < Elements.Num(); ElementIndex++)
+	{
+		const FPreviewElement& Element = Elements[ElementIndex];
+		const bool bDimmed = SelectedElement != INDEX_NONE && SelectedElement != ElementIndex;
+		const SlateIndex BaseIndex = static_cast<SlateIndex>(BatchVertices.Num());
+		for (int32 i = 0; i < Element.Positions.Num(); i++)
+		{
+			FColor Color = Element.Colors[i];
+			Color.A = bDimmed ? 64 : 255;
+			BatchVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, ViewOffset + Element.Positions[i] * ViewScale, FVector2f::ZeroVector, Color));
+		}
+		for (SlateIndex Index : Element.Indices)
+		{
+			BatchIndices.Add(BaseIndex + Index);
+		}
+	}
+
+	LayerId++;
+	if (BatchIndices.Num() > 0)
+	{
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, WhiteResource, BatchVertices, BatchIndices, nullptr, 0, 0);
+	}
+
+	int32 NumWireEdges = 0;
+	for (int32 ElementIndex = 0; ElementIndex < Elements.Num(); ElementIndex++)
+	{
+		if (SelectedElement == INDEX_NONE || SelectedElement == ElementIndex)
+		{
+			NumWireEdges += Elements[ElementIndex].EdgeIndices.Num() / 2;
+		}
+	}
+	const bool bDrawWireframe = bShowWireframe && NumWireEdges > 0 && NumWireEdges <= SVGPreviewMaxWireEdges;
+
+	if (bDrawWireframe)
+	{
+		// One thin quad per edge, widened in widget space so lines stay a pixel wide at any zoom,
+		// sent as a second custom vertex batch over the caps.
+		const FColor WireColor = FLinearColor(1.0f, 1.0f, 1.0f, 0.35f).ToFColor(true);
+		WireVertices.Reset(NumWireEdges * 4);
+		WireIndices.Reset(NumWireEdges * 6);
+		for (int32 ElementIndex = 0; ElementIndex < Elements.Num(); ElementIndex++)
+		{
+			if (SelectedElement != INDEX_NONE && SelectedElement != ElementIndex)
+			{
+				continue;
+			}
+			const FPreviewElement& Element = Elements[ElementIndex];
+			for (int32 i = 0; i + 1 < Element.EdgeIndices.Num(); i += 2)
+			{
+				const FVector2f Start = ViewOffset + Element.Positions[Element.EdgeIndices[i]] * ViewScale;
+				const FVector2f End = ViewOffset + Element.Positions[Element.EdgeIndices[i + 1]] * ViewScale;
+				const FVector2f Direction = (End - Start).GetSafeNormal();
+				const FVector2f Offset = FVector2f(-Direction.Y, Direction.X) * SVGPreviewWireHalfWidth;
+
+				const SlateIndex BaseIndex = static_cast<SlateIndex>(WireVertices.Num());
+				WireVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, Start + Offset, FVector2f::ZeroVector, WireColor));
+				WireVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, End + Offset, FVector2f::ZeroVector, WireColor));
+				WireVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, End - Offset, FVector2f::ZeroVector, WireColor));
+				WireVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, Start - Offset, FVector2f::ZeroVector, WireColor));
+				WireIndices.Append({ BaseIndex, static_cast<SlateIndex>(BaseIndex + 1), static_cast<SlateIndex>(BaseIndex + 2), BaseIndex, static_cast<SlateIndex>(BaseIndex + 2), static_cast<SlateIndex>(BaseIndex + 3) });
+			}
+		}
+
+		LayerId++;
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, WhiteResource, WireVertices, WireIndices, nullptr, 0, 0);
+	}
+
+	// Counts cover what would be generated, independent of the selection.
+	FString Stats = FString::Printf(TEXT("Cap triangles: %d  Vertices: %d  Mesh triangles: %d"), NumIndices / 3, NumVertices, NumMeshTriangles);
+	if (SelectedElement != INDEX_NONE)
+	{
+		const FPreviewElement& Selected = Elements[SelectedElement];
+		Stats += FString::Printf(TEXT("\nElement %d: %d cap triangles, %d mesh triangles"), SelectedElement, Selected.Indices.Num() / 3, Selected.NumMeshTriangles);
+	}
+	if (bShowWireframe && !bDrawWireframe && NumWireEdges > 0)
+	{
+		Stats += FString::Printf(TEXT("\nWireframe hidden above %d edges, select an element to see its triangles"), SVGPreviewMaxWireEdges);
+	}
+	LayerId++;
+	FSlateDrawElement::MakeText(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(AllottedGeometry.GetLocalSize(), FSlateLayoutTransform(FVector2f(6.0f, 4.0f))), Stats, FCoreStyle::GetDefaultFontStyle("Regular", 9), ESlateDrawEffect::None, FLinearColor::White);
+
+	return LayerId;
+}
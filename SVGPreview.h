@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Rendering/RenderingCommon.h"
+#include "SVGMeshData.h"
+
+// Flat top-down preview of the generated caps, drawn with Slate custom vertices so
+// tessellation settings can be checked without spawning anything into the world.
+class SSVGPreview : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSVGPreview) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Drops every element, ready for a new set of NumElements.
+	void ResetElements(int32 NumElements);
+
+	// Replaces one element's preview with the top caps of its extruded Meshes, drawn in order.
+	// Only this element is re-read, the others keep their cached buffers.
+	void SetElementMesh(int32 ElementIndex, const TArray<const FSVGMeshData*>& Meshes);
+
+	// INDEX_NONE frames every element, otherwise the view zooms to the selected element and dims the rest.
+	void SetSelectedElement(int32 ElementIndex);
+	void SetShowWireframe(bool bInShowWireframe);
+
+	// SWidget interface
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	// Cap triangles of one element in SVG units, indexed into its own vertices.
+	struct FPreviewElement
+	{
+		TArray<FVector2f> Positions;
+		TArray<FColor> Colors;
+		TArray<SlateIndex> Indices;
+		// Unique triangle edges as index pairs into Positions, for the wireframe.
+		TArray<SlateIndex> EdgeIndices;
+		FBox2f Bounds = FBox2f(ForceInit);
+		int32 NumMeshTriangles = 0;
+	};
+
+	TArray<FPreviewElement> Elements;
+	int32 SelectedElement = INDEX_NONE;
+	bool bShowWireframe = false;
+
+	FSlateResourceHandle WhiteResource;
+
+	// Scratch buffers reused between paints.
+	mutable TArray<FSlateVertex> BatchVertices;
+	mutable TArray<SlateIndex> BatchIndices;
+	mutable TArray<FSlateVertex> WireVertices;
+	mutable TArray<SlateIndex> WireIndices;
+};
@@ -0,0 +1,212 @@
+#include "SVGStaticMeshBaker.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/Material.h"
+#include "MeshDescription.h"
+#include "ObjectTools.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "StaticMeshAttributes.h"
+#include "SVGVertexColorMaterial.h"
+#include "UObject/Package.h"
+
+static const FName SVGMaterialSlotName(TEXT("SVGMaterial"));
+
+// Box-projected UVs, one tile per metre.
+static constexpr float SVGUVScale = 0.01f;
+
+TArray<UStaticMesh*> FSVGStaticMeshBaker::Bake(const TArray<FSVGMeshBatch>& Batches, const FSVGBakeSettings& Settings)
+{
+	TArray<FSVGMeshBatch> MergedBatches;
+	if (Settings.bMergeMeshes && Batches.Num() > 1)
+	{
+		MergedBatches.Add(MergeBatches(Batches));
+	}
+	const TArray<FSVGMeshBatch>& BakeBatches = MergedBatches.Num() > 0 ? MergedBatches : Batches;
+
+	// One job per LOD, so a batch with a long chain doesn't hold up the others.
+	TArray<FIntPoint> Jobs;
+	TArray<TArray<FMeshDescription>> Descriptions;
+	Descriptions.SetNum(BakeBatches.Num());
+	for (int32 BatchIndex = 0; BatchIndex < BakeBatches.Num(); BatchIndex++)
+	{
+		Descriptions[BatchIndex].SetNum(BakeBatches[BatchIndex].LODs.Num());
+		for (int32 LODIndex = 0; LODIndex < BakeBatches[BatchIndex].LODs.Num(); LODIndex++)
+		{
+			Jobs.Emplace(BatchIndex, LODIndex);
+		}
+	}
+
+	ParallelFor(Jobs.Num(), [&BakeBatches, &Descriptions, &Jobs](int32 JobIndex)
+	{
+		const FIntPoint& Job = Jobs[JobIndex];
+		BuildMeshDescription(BakeBatches[Job.X].LODs[Job.Y], Descriptions[Job.X][Job.Y]);
+	});
+
+	// UObjects can only be created on the game thread.
+	TArray<UStaticMesh*> StaticMeshes;
+	for (int32 BatchIndex = 0; BatchIndex < BakeBatches.Num(); BatchIndex++)
+	{
+		const FSVGMeshBatch& Batch = BakeBatches[BatchIndex];
+		if (Batch.LODs.Num() == 0 || Batch.LODs[0].IsEmpty())
+		{
+			continue;
+		}
+
+		UStaticMesh* StaticMesh = CreateStaticMeshAsset(Settings.PackagePath, Batch.Name);
+		if (!StaticMesh)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to create static mesh asset for %s"), *Batch.Name);
+			continue;
+		}
+
+		StaticMesh->GetStaticMaterials().Add(FStaticMaterial(FSVGVertexColorMaterial::Get(), SVGMaterialSlotName));
+		StaticMesh->bAutoComputeLODScreenSize = false;
+		StaticMesh->NaniteSettings.bEnabled = Settings.bEnableNanite;
+
+		for (int32 LODIndex = 0; LODIndex < Batch.LODs.Num(); LODIndex++)
+		{
+			FStaticMeshSourceModel& SourceModel = StaticMesh->AddSourceModel();
+			// Normals are written flat per triangle so caps and walls keep hard edges.
+			SourceModel.BuildSettings.bRecomputeNormals = false;
+			SourceModel.BuildSettings.bRecomputeTangents = true;
+			SourceModel.BuildSettings.bGenerateLightmapUVs = true;
+			SourceModel.BuildSettings.SrcLightmapIndex = 0;
+			SourceModel.BuildSettings.DstLightmapIndex = 1;
+			SourceModel.ScreenSize.Default = FSVGMeshBatch::GetLODScreenSize(LODIndex);
+
+			FMeshDescription* MeshDescription = StaticMesh->CreateMeshDescription(LODIndex);
+			*MeshDescription = MoveTemp(Descriptions[BatchIndex][LODIndex]);
+			StaticMesh->CommitMeshDescription(LODIndex);
+		}
+		StaticMesh->SetLightMapCoordinateIndex(1);
+
+		if (Settings.bBuildCollision)
+		{
+			StaticMesh->CreateBodySetup();
+			StaticMesh->GetBodySetup()->CollisionTraceFlag = CTF_UseComplexAsSimple;
+		}
+
+		StaticMeshes.Add(StaticMesh);
+	}
+
+	// Builds the render data of every asset concurrently.
+	UStaticMesh::BatchBuild(StaticMeshes);
+
+	for (UStaticMesh* StaticMesh : StaticMeshes)
+	{
+		StaticMesh->MarkPackageDirty();
+		FAssetRegistryModule::AssetCreated(StaticMesh);
+	}
+
+	return StaticMeshes;
+}
+
+void FSVGStaticMeshBaker::BuildMeshDescription(const FSVGMeshData& Mesh, FMeshDescription& OutDescription)
+{
+	FStaticMeshAttributes Attributes(OutDescription);
+	Attributes.Register();
+
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	TVertexInstanceAttributesRef<FVector4f> Colors = Attributes.GetVertexInstanceColors();
+	TPolygonGroupAttributesRef<FName> MaterialSlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+	OutDescription.ReserveNewVertices(Mesh.Vertices.Num());
+	OutDescription.ReserveNewVertexInstances(Mesh.Triangles.Num());
+	OutDescription.ReserveNewTriangles(Mesh.Triangles.Num() / 3);
+
+	const FPolygonGroupID PolygonGroup = OutDescription.CreatePolygonGroup();
+	MaterialSlotNames[PolygonGroup] = SVGMaterialSlotName;
+
+	TArray<FVertexID> VertexIDs;
+	VertexIDs.SetNumUninitialized(Mesh.Vertices.Num());
+	for (int32 i = 0; i < Mesh.Vertices.Num(); i++)
+	{
+		VertexIDs[i] = OutDescription.CreateVertex();
+		Positions[VertexIDs[i]] = FVector3f(Mesh.Vertices[i]);
+	}
+
+	for (int32 i = 0; i + 2 < Mesh.Triangles.Num(); i += 3)
+	{
+		const int32 Corners[3] = { Mesh.Triangles[i], Mesh.Triangles[i + 1], Mesh.Triangles[i + 2] };
+		const FVector& P0 = Mesh.Vertices[Corners[0]];
+		const FVector& P1 = Mesh.Vertices[Corners[1]];
+		const FVector& P2 = Mesh.Vertices[Corners[2]];
+
+		const FVector Normal = FVector::CrossProduct(P2 - P0, P1 - P0).GetSafeNormal();
+		if (Normal.IsNearlyZero())
+		{
+			// Degenerate triangles would only produce build warnings.
+			continue;
+		}
+
+		// Box projection onto the axis plane the triangle faces most. Walls stand vertical, so
+		// a top-down projection would give them zero area and degenerate lightmap charts.
+		const FVector AbsNormal = Normal.GetAbs();
+		const int32 MajorAxis = AbsNormal.Z >= AbsNormal.X && AbsNormal.Z >= AbsNormal.Y ? 2 : (AbsNormal.X >= AbsNormal.Y ? 0 : 1);
+
+		FVertexInstanceID Instances[3];
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			const FVector& Position = Mesh.Vertices[Corners[Corner]];
+			Instances[Corner] = OutDescription.CreateVertexInstance(VertexIDs[Corners[Corner]]);
+			Normals[Instances[Corner]] = FVector3f(Normal);
+			const FVector2D Projected = MajorAxis == 2 ? FVector2D(Position.X, Position.Y) : (MajorAxis == 0 ? FVector2D(Position.Y, Position.Z) : FVector2D(Position.X, Position.Z));
+			UVs[Instances[Corner]] = FVector2f(Projected * SVGUVScale);
+			if (Mesh.Colors.IsValidIndex(Corners[Corner]))
+			{
+				// The build encodes back to sRGB, so baked and procedural meshes end up with the same bytes.
+				Colors[Instances[Corner]] = FVector4f(FLinearColor(Mesh.Colors[Corners[Corner]]));
+			}
+		}
+		OutDescription.CreateTriangle(PolygonGroup, MakeArrayView(Instances));
+	}
+}
+
+FSVGMeshBatch FSVGStaticMeshBaker::MergeBatches(const TArray<FSVGMeshBatch>& Batches)
+{
+	FSVGMeshBatch Merged;
+	Merged.Name = TEXT("SVG_Merged");
+
+	// Pivot at the centre of the top face of everything being merged.
+	FBox Bounds(ForceInit);
+	for (const FSVGMeshBatch& Batch : Batches)
+	{
+		if (Batch.LODs.Num() > 0)
+		{
+			Bounds += Batch.LODs[0].GetBounds().ShiftBy(Batch.Origin);
+		}
+		Merged.LODs.SetNum(FMath::Max(Merged.LODs.Num(), Batch.LODs.Num()));
+	}
+	Merged.Origin = FVector(Bounds.GetCenter().X, Bounds.GetCenter().Y, 0.f);
+
+	for (const FSVGMeshBatch& Batch : Batches)
+	{
+		for (int32 LODIndex = 0; LODIndex < Batch.LODs.Num(); LODIndex++)
+		{
+			FSVGMeshData LOD = Batch.LODs[LODIndex];
+			LOD.MakeRelativeTo(Merged.Origin - Batch.Origin);
+			Merged.LODs[LODIndex].Append(LOD);
+		}
+	}
+	return Merged;
+}
+
+UStaticMesh* FSVGStaticMeshBaker::CreateStaticMeshAsset(const FString& PackagePath, const FString& Name)
+{
+	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+
+	FString PackageName;
+	FString AssetName;
+	AssetToolsModule.Get().CreateUniqueAssetName(PackagePath / ObjectTools::SanitizeObjectName(TEXT("SM_") + Name), TEXT(""), PackageName, AssetName);
+
+	UPackage* Package = CreatePackage(*PackageName);
+	if (!Package)
+	{
+		return nullptr;
+	}
+	return NewObject<UStaticMesh>(Package, *AssetName, RF_Public | RF_Standalone);
+}
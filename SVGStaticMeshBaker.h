@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SVGMeshData.h"
+
+class UStaticMesh;
+struct FMeshDescription;
+
+// Options for baking generated geometry into UStaticMesh assets.
+struct FSVGBakeSettings
+{
+	// Content folder the assets are created in.
+	FString PackagePath = TEXT("/Game/SVGBakes");
+
+	// Bake every batch into one asset instead of one asset per element or tile.
+	bool bMergeMeshes = false;
+
+	// Use the render geometry as complex-as-simple collision.
+	bool bBuildCollision = true;
+
+	bool bEnableNanite = false;
+};
+
+class FSVGStaticMeshBaker
+{
+public:
+	// Fills one mesh description per batch LOD in parallel, then creates the assets
+	// on the game thread and builds their render data as a single parallel batch.
+	static TArray<UStaticMesh*> Bake(const TArray<FSVGMeshBatch>& Batches, const FSVGBakeSettings& Settings);
+
+private:
+	static void BuildMeshDescription(const FSVGMeshData& Mesh, FMeshDescription& OutDescription);
+	static FSVGMeshBatch MergeBatches(const TArray<FSVGMeshBatch>& Batches);
+	static UStaticMesh* CreateStaticMeshAsset(const FString& PackagePath, const FString& Name);
+};
@@ -0,0 +1,332 @@
+#include "SVGStroker.h"
+#include "Algo/Reverse.h"
+
+// Round joins and caps are split into arcs of at most this angle.
+static constexpr double SVGRoundStep = PI / 8.0;
+// Points a half-turn arc needs at that step, both ends included.
+static constexpr int32 SVGMaxArcPoints = 9;
+
+static FVector2D LeftNormal(const FVector2D& Direction)
+{
+	return FVector2D(-Direction.Y, Direction.X);
+}
+
+// Appends points on the arc around Center starting at direction From and sweeping by
+// Sweep radians, both ends included.
+static void AppendArc(const FVector2D& Center, const FVector2D& From, double Sweep, double Radius, TArray<FVector2D>& Out)
+{
+	const double Start = FMath::Atan2(From.Y, From.X);
+	const int32 Steps = FMath::Max(1, FMath::CeilToInt(FMath::Abs(Sweep) / SVGRoundStep));
+	for (int32 Step = 0; Step <= Steps; Step++)
+	{
+		const double Angle = Start + Sweep * Step / Steps;
+		Out.Add(Center + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius);
+	}
+}
+
+bool FSVGStroker::IsClosedOutline(const FSVGElements& Element)
+{
+	return !Element.ElementType.Equals(TEXT("line"), ESearchCase::IgnoreCase) &&
+		!Element.ElementType.Equals(TEXT("polyline"), ESearchCase::IgnoreCase);
+}
+
+bool FSVGStroker::Stroke(const FSVGElements& Source, FSVGElements& OutRibbon)
+{
+	const bool bClosed = IsClosedOutline(Source);
+	const double HalfWidth = Source.StrokeWidth * 0.5;
+
+	// Repeated points have no direction to offset along.
+	TArray<FVector2D> Points;
+	Points.Reserve(Source.Vertices.Num());
+	for (const FVector2D& Point : Source.Vertices)
+	{
+		if (Points.Num() == 0 || !Points.Last().Equals(Point, UE_KINDA_SMALL_NUMBER))
+		{
+			Points.Add(Point);
+		}
+	}
+	if (bClosed && Points.Num() > 1 && Points.Last().Equals(Points[0], UE_KINDA_SMALL_NUMBER))
+	{
+		Points.Pop();
+	}
+
+	const int32 NumPoints = Points.Num();
+	if (HalfWidth <= 0.0 || NumPoints < (bClosed ? 3 : 2))
+	{
+		return false;
+	}
+
+	if (bClosed)
+	{
+		// Walk closed outlines counterclockwise, so the left side is always the inner one.
+		double TwiceArea = 0.0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			TwiceArea += FVector2D::CrossProduct(Points[i], Points[(i + 1) % NumPoints]);
+		}
+		if (TwiceArea < 0.0)
+		{
+			Algo::Reverse(Points);
+		}
+	}
+
+	// Offset points on either side of the outline, grouped per outline point in travel order.
+	// A group holds one point on the inside of a turn and one or more (the join) on the outside.
+	const int32 MaxJoinPoints = Source.StrokeLineJoin == ESVGLineJoin::Round ? SVGMaxArcPoints : 2;
+	TArray<FVector2D> Left;
+	TArray<FVector2D> Right;
+	Left.Reserve(NumPoints * MaxJoinPoints);
+	Right.Reserve(NumPoints * MaxJoinPoints);
+	TArray<int32> LeftStarts;
+	TArray<int32> RightStarts;
+	LeftStarts.SetNumUninitialized(NumPoints + 1);
+	RightStarts.SetNumUninitialized(NumPoints + 1);
+
+	for (int32 i = 0; i < NumPoints; i++)
+	{
+		LeftStarts[i] = Left.Num();
+		RightStarts[i] = Right.Num();
+
+		const FVector2D& Point = Points[i];
+		const bool bHasPrevious = bClosed || i > 0;
+		const bool bHasNext = bClosed || i < NumPoints - 1;
+		const FVector2D In = bHasPrevious ? (Point - Points[(i + NumPoints - 1) % NumPoints]).GetSafeNormal() : FVector2D::ZeroVector;
+		const FVector2D Out = bHasNext ? (Points[(i + 1) % NumPoints] - Point).GetSafeNormal() : FVector2D::ZeroVector;
+
+		// Open ends take the normal of their only segment, caps are added later.
+		if (!bHasPrevious || !bHasNext)
+		{
+			const FVector2D Normal = LeftNormal(bHasPrevious ? In : Out);
+			Left.Add(Point + Normal * HalfWidth);
+			Right.Add(Point - Normal * HalfWidth);
+			continue;
+		}
+
+		const FVector2D InNormal = LeftNormal(In);
+		const FVector2D OutNormal = LeftNormal(Out);
+		const double Turn = FVector2D::CrossProduct(In, Out);
+		if (FMath::Abs(Turn) < UE_KINDA_SMALL_NUMBER && FVector2D::DotProduct(In, Out) > 0.0)
+		{
+			Left.Add(Point + InNormal * HalfWidth);
+			Right.Add(Point - InNormal * HalfWidth);
+			continue;
+		}
+
+		// A left turn puts the left side on the inside.
+		const double OuterSign = Turn > 0.0 ? -1.0 : 1.0;
+		TArray<FVector2D>& Inner = Turn > 0.0 ? Left : Right;
+		TArray<FVector2D>& Outer = Turn > 0.0 ? Right : Left;
+
+		const FVector2D MiterDirection = (InNormal + OutNormal).GetSafeNormal();
+		const double CosHalfAngle = FVector2D::DotProduct(MiterDirection, InNormal);
+		const double MiterScale = CosHalfAngle > UE_KINDA_SMALL_NUMBER ? 1.0 / CosHalfAngle : TNumericLimits<double>::Max();
+
+		// The inner corner is the miter point, clamped so hairpin turns don't throw it far away,
+		// and so it never runs further along either segment than the segment is long.
+		double InnerDistance = HalfWidth * FMath::Min(MiterScale, static_cast<double>(Source.StrokeMiterLimit));
+		const double SinHalfAngle = FMath::Abs(FVector2D::DotProduct(MiterDirection, In));
+		if (SinHalfAngle > UE_KINDA_SMALL_NUMBER)
+		{
+			const double InLength = FVector2D::Distance(Point, Points[(i + NumPoints - 1) % NumPoints]);
+			const double OutLength = FVector2D::Distance(Point, Points[(i + 1) % NumPoints]);
+			InnerDistance = FMath::Min(InnerDistance, FMath::Min(InLength, OutLength) / SinHalfAngle);
+		}
+		Inner.Add(Point - MiterDirection * OuterSign * InnerDistance);
+
+		if (Source.StrokeLineJoin == ESVGLineJoin::Miter && MiterScale <= Source.StrokeMiterLimit)
+		{
+			Outer.Add(Point + MiterDirection * OuterSign * HalfWidth * MiterScale);
+		}
+		else if (Source.StrokeLineJoin == ESVGLineJoin::Round)
+		{
+			const FVector2D From = InNormal * OuterSign;
+			const FVector2D To = OutNormal * OuterSign;
+			const double Sweep = FMath::Atan2(FVector2D::CrossProduct(From, To), FVector2D::DotProduct(From, To));
+			AppendArc(Point, From, Sweep, HalfWidth, Outer);
+		}
+		else
+		{
+			// Bevel, and miters beyond the miter limit.
+			Outer.Add(Point + InNormal * OuterSign * HalfWidth);
+			Outer.Add(Point + OutNormal * OuterSign * HalfWidth);
+		}
+	}
+	LeftStarts[NumPoints] = Left.Num();
+	RightStarts[NumPoints] = Right.Num();
+
+	if (bClosed)
+	{
+		// Once the stroke is wider than the shape, the inner offsets pass each other and the
+		// inner loop folds over itself: its edges turn against the outline they follow.
+		bool bInnerLoopFolded = false;
+		for (int32 i = 0; i < NumPoints && !bInnerLoopFolded; i++)
+		{
+			const int32 Next = (i + 1) % NumPoints;
+			const FVector2D InnerEdge = Left[LeftStarts[Next]] - Left[LeftStarts[i + 1] - 1];
+			bInnerLoopFolded = FVector2D::DotProduct(InnerEdge, Points[Next] - Points[i]) <= 0.0;
+		}
+
+		if (bInnerLoopFolded)
+		{
+			// The stroke covers the whole shape, so it becomes a solid polygon of the outer loop.
+			OutRibbon = FSVGElements(TEXT("stroke"));
+			OutRibbon.FillColor = Source.StrokeColor;
+			OutRibbon.Vertices = MoveTemp(Right);
+			OutRibbon.Triangles.Reserve(3 * (OutRibbon.Vertices.Num() - 2));
+			for (int32 k = 1; k + 1 < OutRibbon.Vertices.Num(); k++)
+			{
+				OutRibbon.Triangles.Append({ 0, k, k + 1 });
+			}
+			return true;
+		}
+	}
+
+	// Cap points between the two sides at each open end, excluding the side points themselves.
+	TArray<FVector2D> EndCap;
+	TArray<FVector2D> StartCap;
+	if (!bClosed && Source.StrokeLineCap != ESVGLineCap::Butt)
+	{
+		const FVector2D EndDirection = (Points[NumPoints - 1] - Points[NumPoints - 2]).GetSafeNormal();
+		const FVector2D StartDirection = (Points[0] - Points[1]).GetSafeNormal();
+		if (Source.StrokeLineCap == ESVGLineCap::Square)
+		{
+			EndCap.Add(Left.Last() + EndDirection * HalfWidth);
+			EndCap.Add(Right.Last() + EndDirection * HalfWidth);
+			StartCap.Add(Right[0] + StartDirection * HalfWidth);
+			StartCap.Add(Left[0] + StartDirection * HalfWidth);
+		}
+		else
+		{
+			// Half turns from the left side round to the right at the end, and back at the start.
+			AppendArc(Points[NumPoints - 1], LeftNormal(EndDirection), -PI, HalfWidth, EndCap);
+			AppendArc(Points[0], LeftNormal(StartDirection), -PI, HalfWidth, StartCap);
+			EndCap.RemoveAt(EndCap.Num() - 1);
+			EndCap.RemoveAt(0);
+			StartCap.RemoveAt(StartCap.Num() - 1);
+			StartCap.RemoveAt(0);
+		}
+	}
+
+	// Boundary layout. Closed: the right (outer) side, then the left (inner) side reversed so the
+	// hole winds the other way. Open: left side, end cap, right side reversed, start cap.
+	const int32 NumLeft = Left.Num();
+	const int32 NumRight = Right.Num();
+	auto LeftIndex = [&](int32 k) { return bClosed ? NumRight + (NumLeft - 1 - k) : k; };
+	auto RightIndex = [&](int32 k) { return bClosed ? k : NumLeft + EndCap.Num() + (NumRight - 1 - k); };
+	const int32 EndCapBase = NumLeft;
+	const int32 StartCapBase = NumLeft + EndCap.Num() + NumRight;
+
+	OutRibbon = FSVGElements(TEXT("stroke"));
+	OutRibbon.FillColor = Source.StrokeColor;
+	OutRibbon.Vertices.Reserve(NumLeft + NumRight + EndCap.Num() + StartCap.Num());
+	if (bClosed)
+	{
+		OutRibbon.Vertices.Append(Right);
+		for (int32 k = NumLeft - 1; k >= 0; k--)
+		{
+			OutRibbon.Vertices.Add(Left[k]);
+		}
+		OutRibbon.ContourStarts = { 0, NumRight };
+	}
+	else
+	{
+		OutRibbon.Vertices.Append(Left);
+		OutRibbon.Vertices.Append(EndCap);
+		for (int32 k = NumRight - 1; k >= 0; k--)
+		{
+			OutRibbon.Vertices.Add(Right[k]);
+		}
+		OutRibbon.Vertices.Append(StartCap);
+	}
+
+	// Join fans, two triangles per segment and one fan per cap.
+	const int32 NumSegments = bClosed ? NumPoints : NumPoints - 1;
+	const int32 NumCapTriangles = StartCap.Num() + EndCap.Num();
+	OutRibbon.Triangles.Reserve(3 * ((NumLeft - NumPoints) + (NumRight - NumPoints) + 2 * NumSegments + NumCapTriangles));
+
+	// Same orientation as the fan of a counterclockwise polygon, whatever order the corners come in.
+	const TArray<FVector2D>& Ribbon = OutRibbon.Vertices;
+	auto AddTriangle = [&OutRibbon, &Ribbon](int32 A, int32 B, int32 C)
+	{
+		if (FVector2D::CrossProduct(Ribbon[B] - Ribbon[A], Ribbon[C] - Ribbon[A]) < 0.0)
+		{
+			Swap(B, C);
+		}
+		OutRibbon.Triangles.Append({ A, B, C });
+	};
+
+	for (int32 i = 0; i < NumPoints; i++)
+	{
+		for (int32 k = LeftStarts[i]; k + 1 < LeftStarts[i + 1]; k++)
+		{
+			AddTriangle(RightIndex(RightStarts[i]), LeftIndex(k), LeftIndex(k + 1));
+		}
+		for (int32 k = RightStarts[i]; k + 1 < RightStarts[i + 1]; k++)
+		{
+			AddTriangle(LeftIndex(LeftStarts[i]), RightIndex(k), RightIndex(k + 1));
+		}
+	}
+
+	for (int32 i = 0; i < NumSegments; i++)
+	{
+		const int32 Next = (i + 1) % NumPoints;
+		const int32 LeftFrom = LeftIndex(LeftStarts[i + 1] - 1);
+		const int32 LeftTo = LeftIndex(LeftStarts[Next]);
+		const int32 RightFrom = RightIndex(RightStarts[i + 1] - 1);
+		const int32 RightTo = RightIndex(RightStarts[Next]);
+		AddTriangle(LeftFrom, LeftTo, RightTo);
+		AddTriangle(LeftFrom, RightTo, RightFrom);
+	}
+
+	if (!bClosed)
+	{
+		// Fan each cap from its first side point across the cap points to the other side.
+		const int32 LeftEnd = LeftIndex(NumLeft - 1);
+		int32 Previous = LeftEnd;
+		for (int32 k = 0; k < EndCap.Num(); k++)
+		{
+			if (Previous != LeftEnd)
+			{
+				AddTriangle(LeftEnd, Previous, EndCapBase + k);
+			}
+			Previous = EndCapBase + k;
+		}
+		if (Previous != LeftEnd)
+		{
+			AddTriangle(LeftEnd, Previous, RightIndex(NumRight - 1));
+		}
+
+		const int32 RightStart = RightIndex(0);
+		Previous = RightStart;
+		for (int32 k = 0; k < StartCap.Num(); k++)
+		{
+			if (Previous != RightStart)
+			{
+				AddTriangle(RightStart, Previous, StartCapBase + k);
+			}
+			Previous = StartCapBase + k;
+		}
+		if (Previous != RightStart)
+		{
+			AddTriangle(RightStart, Previous, LeftIndex(0));
+		}
+
+		// The single boundary loop has to wind counterclockwise like every other outline.
+		double TwiceArea = 0.0;
+		for (int32 i = 0; i < Ribbon.Num(); i++)
+		{
+			TwiceArea += FVector2D::CrossProduct(Ribbon[i], Ribbon[(i + 1) % Ribbon.Num()]);
+		}
+		if (TwiceArea < 0.0)
+		{
+			const int32 LastIndex = OutRibbon.Vertices.Num() - 1;
+			Algo::Reverse(OutRibbon.Vertices);
+			for (int32& Index : OutRibbon.Triangles)
+			{
+				Index = LastIndex - Index;
+			}
+		}
+	}
+
+	return true;
+}
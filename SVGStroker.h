@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SVGElements.h"
+
+// Turns element outlines into stroke ribbons that extrude like any filled polygon.
+class FSVGStroker
+{
+public:
+	// Strokes Source's outline with its stroke width, joins and caps. rect, circle and polygon
+	// outlines are closed and give a ribbon with an outer and an inner boundary loop; line and
+	// polyline outlines are open and give a single loop around the capped ribbon. A closed
+	// stroke wider than its shape has no hole left and comes out as the solid outer loop.
+	// OutRibbon gets type "stroke", the boundary loops in Vertices and ContourStarts, the cap
+	// triangulation in Triangles and the stroke colour as its fill. The outline is walked once,
+	// and the output arrays are sized before they are filled.
+	static bool Stroke(const FSVGElements& Source, FSVGElements& OutRibbon);
+
+	static bool IsClosedOutline(const FSVGElements& Element);
+};
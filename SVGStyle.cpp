@@ -0,0 +1,336 @@
+#include "SVGStyle.h"
+#include "XmlNode.h"
+
+void FSVGStyleSheet::Reset()
+{
+	TagRules.Reset();
+	ClassRules.Reset();
+	IdRules.Reset();
+}
+
+void FSVGStyleSheet::Parse(const FString& Css)
+{
+	// Strip comments first so braces inside them can't confuse the rule scan.
+	FString Text = Css;
+	int32 CommentStart = Text.Find(TEXT("/*"));
+	while (CommentStart != INDEX_NONE)
+	{
+		const int32 CommentEnd = Text.Find(TEXT("*/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, CommentStart + 2);
+		Text.RemoveAt(CommentStart, (CommentEnd == INDEX_NONE ? Text.Len() : CommentEnd + 2) - CommentStart);
+		CommentStart = Text.Find(TEXT("/*"));
+	}
+
+	int32 Cursor = 0;
+	while (Cursor < Text.Len())
+	{
+		const int32 Open = Text.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Cursor);
+		if (Open == INDEX_NONE)
+		{
+			break;
+		}
+		const int32 Close = Text.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Open + 1);
+		if (Close == INDEX_NONE)
+		{
+			break;
+		}
+
+		TArray<TPair<FString, FString>> Declarations;
+		ParseDeclarations(Text.Mid(Open + 1, Close - Open - 1), Declarations);
+
+		TArray<FString> Selectors;
+		Text.Mid(Cursor, Open - Cursor).ParseIntoArray(Selectors, TEXT(","), true);
+		for (FString& Selector : Selectors)
+		{
+			Selector.TrimStartAndEndInline();
+			if (Selector.IsEmpty() || Selector.Contains(TEXT(" ")) || Selector.Mid(1).Contains(TEXT(".")) || Selector.Mid(1).Contains(TEXT("#")))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Unsupported CSS selector (ignored): %s"), *Selector);
+				continue;
+			}
+
+			if (Selector.StartsWith(TEXT(".")))
+			{
+				ClassRules.FindOrAdd(Selector.Mid(1)).Append(Declarations);
+			}
+			else if (Selector.StartsWith(TEXT("#")))
+			{
+				IdRules.FindOrAdd(Selector.Mid(1)).Append(Declarations);
+			}
+			else
+			{
+				TagRules.FindOrAdd(Selector.ToLower()).Append(Declarations);
+			}
+		}
+
+		Cursor = Close + 1;
+	}
+}
+
+void FSVGStyleSheet::ParseDeclarations(const FString& Text, TArray<TPair<FString, FString>>& OutDeclarations)
+{
+	TArray<FString> Declarations;
+	Text.ParseIntoArray(Declarations, TEXT(";"), true);
+	for (const FString& Declaration : Declarations)
+	{
+		FString Name;
+		FString Value;
+		if (Declaration.Split(TEXT(":"), &Name, &Value))
+		{
+			Name.TrimStartAndEndInline();
+			Value.TrimStartAndEndInline();
+			if (!Name.IsEmpty() && !Value.IsEmpty())
+			{
+				OutDeclarations.Emplace(Name.ToLower(), Value);
+			}
+		}
+	}
+}
+
+void FSVGStyle::Apply(const FXmlNode* Node, const FSVGStyleSheet& StyleSheet)
+{
+	static const TCHAR* PresentationAttributes[] = {
+		TEXT("fill"), TEXT("fill-opacity"), TEXT("opacity"),
+		TEXT("stroke"), TEXT("stroke-opacity"), TEXT("stroke-width"),
+		TEXT("stroke-linejoin"), TEXT("stroke-linecap"), TEXT("stroke-miterlimit"),
+	};
+
+	// Later sources override earlier ones, so collect into one map and apply each property once.
+	// That matters for opacity, which multiplies rather than replaces.
+	TMap<FString, FString> Properties;
+	for (const TCHAR* Attribute : PresentationAttributes)
+	{
+		const FString Value = Node->GetAttribute(Attribute);
+		if (!Value.IsEmpty())
+		{
+			Properties.Add(Attribute, Value);
+		}
+	}
+
+	auto AddRules = [&Properties](const TArray<TPair<FString, FString>>* Rules)
+	{
+		if (Rules)
+		{
+			for (const TPair<FString, FString>& Rule : *Rules)
+			{
+				Properties.Add(Rule.Key, Rule.Value);
+			}
+		}
+	};
+
+	AddRules(StyleSheet.TagRules.Find(Node->GetTag().ToLower()));
+
+	TArray<FString> Classes;
+	Node->GetAttribute(TEXT("class")).ParseIntoArrayWS(Classes);
+	for (const FString& Class : Classes)
+	{
+		AddRules(StyleSheet.ClassRules.Find(Class));
+	}
+
+	const FString Id = Node->GetAttribute(TEXT("id"));
+	if (!Id.IsEmpty())
+	{
+		AddRules(StyleSheet.IdRules.Find(Id));
+	}
+
+	TArray<TPair<FString, FString>> InlineStyle;
+	FSVGStyleSheet::ParseDeclarations(Node->GetAttribute(TEXT("style")), InlineStyle);
+	AddRules(&InlineStyle);
+
+	for (const TPair<FString, FString>& Property : Properties)
+	{
+		SetProperty(Property.Key, Property.Value);
+	}
+}
+
+void FSVGStyle::SetProperty(const FString& Name, const FString& Value)
+{
+	if (Value.Equals(TEXT("inherit"), ESearchCase::IgnoreCase))
+	{
+		return;
+	}
+
+	if (Name == TEXT("fill"))
+	{
+		if (Value.Equals(TEXT("none"), ESearchCase::IgnoreCase))
+		{
+			bHasFill = false;
+		}
+		else if (ParseColor(Value, Fill))
+		{
+			bHasFill = true;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Unsupported fill (keeping inherited colour): %s"), *Value);
+		}
+	}
+	else if (Name == TEXT("fill-opacity"))
+	{
+		FillOpacity = FMath::Clamp(FCString::Atof(*Value), 0.0f, 1.0f);
+	}
+	else if (Name == TEXT("opacity"))
+	{
+		Opacity *= FMath::Clamp(FCString::Atof(*Value), 0.0f, 1.0f);
+	}
+	else if (Name == TEXT("stroke"))
+	{
+		if (Value.Equals(TEXT("none"), ESearchCase::IgnoreCase))
+		{
+			bHasStroke = false;
+		}
+		else if (ParseColor(Value, Stroke))
+		{
+			bHasStroke = true;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Unsupported stroke (keeping inherited colour): %s"), *Value);
+		}
+	}
+	else if (Name == TEXT("stroke-opacity"))
+	{
+		StrokeOpacity = FMath::Clamp(FCString::Atof(*Value), 0.0f, 1.0f);
+	}
+	else if (Name == TEXT("stroke-width"))
+	{
+		StrokeWidth = FMath::Max(FCString::Atof(*Value), 0.0f);
+	}
+	else if (Name == TEXT("stroke-miterlimit"))
+	{
+		StrokeMiterLimit = FMath::Max(FCString::Atof(*Value), 1.0f);
+	}
+	else if (Name == TEXT("stroke-linejoin"))
+	{
+		if (Value.Equals(TEXT("round"), ESearchCase::IgnoreCase))
+		{
+			StrokeLineJoin = ESVGLineJoin::Round;
+		}
+		else if (Value.Equals(TEXT("bevel"), ESearchCase::IgnoreCase))
+		{
+			StrokeLineJoin = ESVGLineJoin::Bevel;
+		}
+		else
+		{
+			StrokeLineJoin = ESVGLineJoin::Miter;
+		}
+	}
+	else if (Name == TEXT("stroke-linecap"))
+	{
+		if (Value.Equals(TEXT("round"), ESearchCase::IgnoreCase))
+		{
+			StrokeLineCap = ESVGLineCap::Round;
+		}
+		else if (Value.Equals(TEXT("square"), ESearchCase::IgnoreCase))
+		{
+			StrokeLineCap = ESVGLineCap::Square;
+		}
+		else
+		{
+			StrokeLineCap = ESVGLineCap::Butt;
+		}
+	}
+}
+
+FLinearColor FSVGStyle::GetFillColor() const
+{
+	FLinearColor Color(Fill);
+	Color.A = FillOpacity * Opacity;
+	return Color;
+}
+
+FLinearColor FSVGStyle::GetStrokeColor() const
+{
+	FLinearColor Color(Stroke);
+	Color.A = StrokeOpacity * Opacity;
+	return Color;
+}
+
+void FSVGStyle::ApplyTo(FSVGElements& Element) const
+{
+	Element.FillColor = GetFillColor();
+	Element.bFilled = bHasFill;
+	Element.StrokeColor = GetStrokeColor();
+	Element.StrokeWidth = bHasStroke ? StrokeWidth : 0.0f;
+	Element.StrokeMiterLimit = StrokeMiterLimit;
+	Element.StrokeLineJoin = StrokeLineJoin;
+	Element.StrokeLineCap = StrokeLineCap;
+}
+
+bool FSVGStyle::ParseColor(const FString& Value, FColor& OutColor)
+{
+	const FString Color = Value.TrimStartAndEnd().ToLower();
+
+	if (Color.StartsWith(TEXT("#")))
+	{
+		const FString Hex = Color.Mid(1);
+		if (Hex.Len() != 3 && Hex.Len() != 6)
+		{
+			return false;
+		}
+		for (TCHAR Char : Hex)
+		{
+			if (!FChar::IsHexDigit(Char))
+			{
+				return false;
+			}
+		}
+		OutColor = FColor::FromHex(Hex);
+		return true;
+	}
+
+	if (Color.StartsWith(TEXT("rgb(")) && Color.EndsWith(TEXT(")")))
+	{
+		TArray<FString> Channels;
+		Color.Mid(4, Color.Len() - 5).ParseIntoArray(Channels, TEXT(","), true);
+		if (Channels.Num() != 3)
+		{
+			return false;
+		}
+
+		uint8 Bytes[3];
+		for (int32 i = 0; i < 3; i++)
+		{
+			FString Channel = Channels[i].TrimStartAndEnd();
+			float Number = FCString::Atof(*Channel);
+			if (Channel.EndsWith(TEXT("%")))
+			{
+				Number *= 2.55f;
+			}
+			Bytes[i] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Number), 0, 255));
+		}
+		OutColor = FColor(Bytes[0], Bytes[1], Bytes[2]);
+		return true;
+	}
+
+	static const TMap<FString, FColor> NamedColors = {
+		{ TEXT("black"), FColor(0, 0, 0) },
+		{ TEXT("white"), FColor(255, 255, 255) },
+		{ TEXT("red"), FColor(255, 0, 0) },
+		{ TEXT("lime"), FColor(0, 255, 0) },
+		{ TEXT("green"), FColor(0, 128, 0) },
+		{ TEXT("blue"), FColor(0, 0, 255) },
+		{ TEXT("yellow"), FColor(255, 255, 0) },
+		{ TEXT("cyan"), FColor(0, 255, 255) },
+		{ TEXT("aqua"), FColor(0, 255, 255) },
+		{ TEXT("magenta"), FColor(255, 0, 255) },
+		{ TEXT("fuchsia"), FColor(255, 0, 255) },
+		{ TEXT("gray"), FColor(128, 128, 128) },
+		{ TEXT("grey"), FColor(128, 128, 128) },
+		{ TEXT("silver"), FColor(192, 192, 192) },
+		{ TEXT("maroon"), FColor(128, 0, 0) },
+		{ TEXT("olive"), FColor(128, 128, 0) },
+		{ TEXT("navy"), FColor(0, 0, 128) },
+		{ TEXT("purple"), FColor(128, 0, 128) },
+		{ TEXT("teal"), FColor(0, 128, 128) },
+		{ TEXT("orange"), FColor(255, 165, 0) },
+		{ TEXT("brown"), FColor(165, 42, 42) },
+		{ TEXT("pink"), FColor(255, 192, 203) },
+	};
+
+	if (const FColor* Named = NamedColors.Find(Color))
+	{
+		OutColor = *Named;
+		return true;
+	}
+	return false;
+}
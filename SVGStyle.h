@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SVGElements.h"
+
+class FXmlNode;
+
+// Tag, class and id rules collected from <style> blocks. Only simple selectors are
+// supported; compound and descendant selectors are ignored.
+struct FSVGStyleSheet
+{
+	TMap<FString, TArray<TPair<FString, FString>>> TagRules;
+	TMap<FString, TArray<TPair<FString, FString>>> ClassRules;
+	TMap<FString, TArray<TPair<FString, FString>>> IdRules;
+
+	void Parse(const FString& Css);
+	void Reset();
+
+	// Splits "name: value; name: value" into pairs, as used by rule bodies and style attributes.
+	static void ParseDeclarations(const FString& Text, TArray<TPair<FString, FString>>& OutDeclarations);
+};
+
+// Fill and stroke state of an element after inheriting from its parent groups.
+struct FSVGStyle
+{
+	// SVG's initial fill is opaque black.
+	FColor Fill = FColor::Black;
+	bool bHasFill = true;
+	float FillOpacity = 1.0f;
+
+	// SVG's initial stroke is none.
+	FColor Stroke = FColor::Black;
+	bool bHasStroke = false;
+	float StrokeOpacity = 1.0f;
+	float StrokeWidth = 1.0f;
+	float StrokeMiterLimit = 4.0f;
+	ESVGLineJoin StrokeLineJoin = ESVGLineJoin::Miter;
+	ESVGLineCap StrokeLineCap = ESVGLineCap::Butt;
+
+	// Group opacity multiplies down the tree.
+	float Opacity = 1.0f;
+
+	// Resolves one node on top of the inherited state. Presentation attributes come first,
+	// then style sheet rules by tag, class and id, then the inline style attribute.
+	void Apply(const FXmlNode* Node, const FSVGStyleSheet& StyleSheet);
+
+	// Linear fill colour with fill-opacity and opacity folded into alpha.
+	FLinearColor GetFillColor() const;
+	FLinearColor GetStrokeColor() const;
+
+	// Copies the resolved fill and stroke onto a parsed element.
+	void ApplyTo(FSVGElements& Element) const;
+
+	// Accepts #rgb, #rrggbb, rgb(r, g, b) with numbers or percentages, and common colour names.
+	static bool ParseColor(const FString& Value, FColor& OutColor);
+
+private:
+	void SetProperty(const FString& Name, const FString& Value);
+};
@@ -0,0 +1,40 @@
+#include "SVGVertexColorMaterial.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "MaterialEditingLibrary.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpressionPower.h"
+#include "Materials/MaterialExpressionVertexColor.h"
+#include "UObject/Package.h"
+
+const TCHAR* FSVGVertexColorMaterial::AssetPath = TEXT("/Game/SVGBakes/M_SVGVertexColor");
+
+UMaterialInterface* FSVGVertexColorMaterial::Get()
+{
+	const FString ObjectPath = FString::Printf(TEXT("%s.%s"), AssetPath, *FPackageName::GetShortName(AssetPath));
+	if (UMaterialInterface* Existing = LoadObject<UMaterialInterface>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet))
+	{
+		return Existing;
+	}
+
+	UPackage* Package = CreatePackage(AssetPath);
+	if (!Package)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create vertex colour material package, falling back to the default material."));
+		return UMaterial::GetDefaultMaterial(MD_Surface);
+	}
+
+	UMaterial* Material = NewObject<UMaterial>(Package, *FPackageName::GetShortName(AssetPath), RF_Public | RF_Standalone);
+	UMaterialExpression* VertexColor = UMaterialEditingLibrary::CreateMaterialExpression(Material, UMaterialExpressionVertexColor::StaticClass());
+
+	// Vertex colours reach the shader as the sRGB bytes from the SVG, so decode them before use as base colour.
+	UMaterialExpressionPower* Decode = Cast<UMaterialExpressionPower>(UMaterialEditingLibrary::CreateMaterialExpression(Material, UMaterialExpressionPower::StaticClass()));
+	Decode->ConstExponent = 2.2f;
+	UMaterialEditingLibrary::ConnectMaterialExpressions(VertexColor, TEXT(""), Decode, TEXT("Base"));
+	UMaterialEditingLibrary::ConnectMaterialProperty(Decode, TEXT(""), MP_BaseColor);
+	UMaterialEditingLibrary::RecompileMaterial(Material);
+
+	Material->MarkPackageDirty();
+	FAssetRegistryModule::AssetCreated(Material);
+	UE_LOG(LogTemp, Log, TEXT("Created vertex colour material %s"), AssetPath);
+	return Material;
+}
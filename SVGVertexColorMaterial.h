@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMaterialInterface;
+
+// The one material every generated mesh uses. It takes its base colour from the
+// vertex colours, so any number of SVG fills render through a single material.
+struct FSVGVertexColorMaterial
+{
+	static const TCHAR* AssetPath;
+
+	// Loads the material asset, creating it on first use.
+	static UMaterialInterface* Get();
+};
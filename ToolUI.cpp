@@ -6,6 +6,13 @@
 #include "XmlParser.h"
 #include "XmlNode.h"
 #include "MyMesh.h"
+#include "SVGMeshData.h"
+#include "SVGStaticMeshBaker.h"
+#include "SVGMeshCache.h"
+#include "SVGPreview.h"
+#include "SVGStroker.h"
+#include "SVGStyle.h"
+#include "SVGVertexColorMaterial.h"
 #define _USE_MATH_DEFINES
 #include <cmath>
 
@@ -14,6 +21,8 @@
 #include "EntitySystem/MovieSceneEntityManager.h"
 #include "Runtime/CrashReportCore/Public/Android/AndroidErrorReport.h"
 #include "Widgets/Input/SSlider.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBox.h"
 
 void ToolUI::Construct(const FArguments& args)
 {
@@ -46,7 +55,7 @@ void ToolUI::Construct(const FArguments& args)
                 SNew(SButton)
                 .Text(FText::FromString("Browse for files"))
                 .OnClicked(this, &ToolUI::OnBrowseButtonClicked)
-                .ToolTipText(FText::FromString("Only 'rect', 'circle', and 'polygon' elements are supported."))
+                .ToolTipText(FText::FromString("Only 'rect', 'circle', 'polygon', 'polyline' and 'line' elements are supported."))
             ]
         ]
         // convert to text button
@@ -65,7 +74,7 @@ void ToolUI::Construct(const FArguments& args)
         [
             SAssignNew(ExtractedSVGTextBox, SEditableTextBox)
             .HintText(FText::FromString("Extracted svg text will appear here"))
-            .ToolTipText(FText::FromString("Paste or view SVG data here.\nOnly 'rect', 'circle', and 'polygon' elements are supported."))
+            .ToolTipText(FText::FromString("Paste or view SVG data here.\nOnly 'rect', 'circle', 'polygon', 'polyline' and 'line' elements are supported."))
             
         ]
         +SVerticalBox::Slot()
@@ -119,6 +128,173 @@ void ToolUI::Construct(const FArguments& args)
             ]
         ]
 
+        // Tiling Section
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetTileOutputState)
+                .OnCheckStateChanged(this, &ToolUI::OnTileOutputChanged)
+                .ToolTipText(FText::FromString("Bin generated geometry into a uniform grid, one mesh actor per tile."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Tile Output"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("Tile Size:"))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.3f)
+            .Padding(5)
+            [
+                SNew(SEditableTextBox)
+                .Text(this, &ToolUI::GetTileSizeText)
+                .OnTextCommitted(this, &ToolUI::OnTileSizeTextCommitted)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetCullInternalFacesState)
+                .OnCheckStateChanged(this, &ToolUI::OnCullInternalFacesChanged)
+                .ToolTipText(FText::FromString("Drop the hidden side walls between elements that touch, and weld shared vertices of elements in the same tile."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Cull Internal Faces"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetGenerateStrokesState)
+                .OnCheckStateChanged(this, &ToolUI::OnGenerateStrokesChanged)
+                .ToolTipText(FText::FromString("Extrude element strokes as ribbons along their outlines, with the SVG joins and caps."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Generate Strokes"))
+                ]
+            ]
+        ]
+
+        // LOD Section
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("LOD Levels:"))
+                .ToolTipText(FText::FromString("Number of LOD levels per mesh. 1 keeps full detail only."))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.3f)
+            .Padding(5)
+            [
+                SNew(SEditableTextBox)
+                .Text(this, &ToolUI::GetNumLODsText)
+                .OnTextCommitted(this, &ToolUI::OnNumLODsTextCommitted)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("LOD Tolerance:"))
+                .ToolTipText(FText::FromString("Outline simplification tolerance for LOD 1, doubled for every further level."))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.3f)
+            .Padding(5)
+            [
+                SNew(SEditableTextBox)
+                .Text(this, &ToolUI::GetLODToleranceText)
+                .OnTextCommitted(this, &ToolUI::OnLODToleranceTextCommitted)
+            ]
+        ]
+
+        // Preview Section
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("Preview LOD:"))
+                .ToolTipText(FText::FromString("LOD level shown in the preview, limited to the LOD levels above."))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.3f)
+            .Padding(5)
+            [
+                SNew(SEditableTextBox)
+                .Text(this, &ToolUI::GetPreviewLODText)
+                .OnTextCommitted(this, &ToolUI::OnPreviewLODTextCommitted)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("Preview Element:"))
+                .ToolTipText(FText::FromString("Index of the parsed element to zoom to. Leave empty to show every element."))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.3f)
+            .Padding(5)
+            [
+                SNew(SEditableTextBox)
+                .HintText(FText::FromString("All"))
+                .Text(this, &ToolUI::GetPreviewElementText)
+                .OnTextCommitted(this, &ToolUI::OnPreviewElementTextCommitted)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetPreviewWireframeState)
+                .OnCheckStateChanged(this, &ToolUI::OnPreviewWireframeChanged)
+                .ToolTipText(FText::FromString("Outline every previewed triangle."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Wireframe"))
+                ]
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SBox)
+            .HeightOverride(300.0f)
+            [
+                SAssignNew(PreviewWidget, SSVGPreview)
+                .ToolTipText(FText::FromString("Top-down preview of the generated caps. Nothing is spawned until Generate is clicked."))
+            ]
+        ]
+
         // Generate Button Section
         + SVerticalBox::Slot()
         .AutoHeight()
@@ -129,174 +305,718 @@ void ToolUI::Construct(const FArguments& args)
             .OnClicked(this, &ToolUI::OnGenerateButtonClicked)
             .ToolTipText(FText::FromString("Button to generate 3D mesh."))
         ]
+
+        // Mesh Cache Section
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetQuantizeCachePositionsState)
+                .OnCheckStateChanged(this, &ToolUI::OnQuantizeCachePositionsChanged)
+                .ToolTipText(FText::FromString("Store cached positions as 16-bit values relative to each mesh's bounds instead of 32-bit floats."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Quantize"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.5f)
+            .Padding(5)
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Save Mesh Cache"))
+                .OnClicked(this, &ToolUI::OnSaveMeshCacheButtonClicked)
+                .ToolTipText(FText::FromString("Save the generated geometry to a compact .svgmesh file."))
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(0.5f)
+            .Padding(5)
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Load Mesh Cache"))
+                .OnClicked(this, &ToolUI::OnLoadMeshCacheButtonClicked)
+                .ToolTipText(FText::FromString("Spawn mesh actors from a .svgmesh file without re-parsing the SVG."))
+            ]
+        ]
+
+        // Bake Section
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(10)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetMergeMeshesState)
+                .OnCheckStateChanged(this, &ToolUI::OnMergeMeshesChanged)
+                .ToolTipText(FText::FromString("Bake everything into a single static mesh asset instead of one per element or tile."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Merge"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetBakeCollisionState)
+                .OnCheckStateChanged(this, &ToolUI::OnBakeCollisionChanged)
+                .ToolTipText(FText::FromString("Use the baked geometry as collision."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Collision"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &ToolUI::GetBakeNaniteState)
+                .OnCheckStateChanged(this, &ToolUI::OnBakeNaniteChanged)
+                .ToolTipText(FText::FromString("Enable Nanite on the baked assets. Nanite ignores the LOD chain."))
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString("Nanite"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(1.0f)
+            .Padding(5)
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Bake to Static Mesh"))
+                .OnClicked(this, &ToolUI::OnBakeButtonClicked)
+                .ToolTipText(FText::FromString("Write the extruded geometry into static mesh assets under /Game/SVGBakes, using the tiling and LOD settings above."))
+            ]
+        ]
     ];
 }
 
-FReply ToolUI::OnGenerateButtonClicked()
+FReply ToolUI::OnGenerateButtonClicked()
+{
+    UWorld* World = GWorld;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("World not found."));
+        return FReply::Handled();
+    }
+
+    TArray<FSVGMeshBatch> Batches;
+    CollectMeshBatches(Batches);
+    SpawnMeshBatches(World, Batches);
+
+    if (bTileOutput)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Generated %d tiles of size %.2f."), Batches.Num(), TileSize);
+    }
+    UE_LOG(LogTemp, Log, TEXT("Generate Button Clicked, extruded mesh created."));
+    return FReply::Handled();
+}
+
+void ToolUI::SpawnMeshBatches(UWorld* World, const TArray<FSVGMeshBatch>& Batches)
+{
+    for (const FSVGMeshBatch& Batch : Batches)
+    {
+        FActorSpawnParameters SpawnParameters;
+        AMyMeshActor* MeshActor = World->SpawnActor<AMyMeshActor>(AMyMeshActor::StaticClass(), FTransform(Batch.Origin), SpawnParameters);
+        if (MeshActor)
+        {
+            CreateMeshLODs(MeshActor, Batch.LODs);
+#if WITH_EDITOR
+            if (Batch.bTile)
+            {
+                // Named and foldered per cell so tiles can be moved into streaming levels,
+                // and left spatially loaded so World Partition streams them by cell.
+                MeshActor->SetActorLabel(Batch.Name);
+                MeshActor->SetFolderPath(TEXT("SVGTiles"));
+                MeshActor->SetIsSpatiallyLoaded(true);
+            }
+#endif
+        }
+    }
+}
+
+FReply ToolUI::OnSaveMeshCacheButtonClicked()
+{
+    TArray<FSVGMeshBatch> Batches;
+    CollectMeshBatches(Batches);
+    if (Batches.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Nothing to cache, extract SVG data first."));
+        return FReply::Handled();
+    }
+
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Desktop Platform is not available."));
+        return FReply::Handled();
+    }
+
+    TArray<FString> UserFiles;
+    DesktopPlatform->SaveFileDialog(
+        nullptr,
+        TEXT("Save mesh cache"),
+        FPaths::ProjectSavedDir(),
+        TEXT("SVGMeshCache.svgmesh"),
+        TEXT("SVG Mesh Cache (*.svgmesh)|*.svgmesh"),
+        EFileDialogFlags::None,
+        UserFiles
+    );
+    if (UserFiles.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No file selected."));
+        return FReply::Handled();
+    }
+
+    const ESVGPositionEncoding Encoding = bQuantizeCachePositions ? ESVGPositionEncoding::Quantized16 : ESVGPositionEncoding::Float32;
+    if (FSVGMeshCache::Save(UserFiles[0], Batches, Encoding))
+    {
+        UE_LOG(LogTemp, Log, TEXT("Mesh cache saved: %s"), *UserFiles[0]);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to save mesh cache: %s"), *UserFiles[0]);
+    }
+    return FReply::Handled();
+}
+
+FReply ToolUI::OnLoadMeshCacheButtonClicked()
+{
+    UWorld* World = GWorld;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("World not found."));
+        return FReply::Handled();
+    }
+
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Desktop Platform is not available."));
+        return FReply::Handled();
+    }
+
+    TArray<FString> UserFiles;
+    DesktopPlatform->OpenFileDialog(
+        nullptr,
+        TEXT("Select a mesh cache"),
+        FPaths::ProjectSavedDir(),
+        TEXT(""),
+        TEXT("SVG Mesh Cache (*.svgmesh)|*.svgmesh"),
+        EFileDialogFlags::None,
+        UserFiles
+    );
+    if (UserFiles.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No file selected."));
+        return FReply::Handled();
+    }
+
+    TArray<FSVGMeshBatch> Batches;
+    if (FSVGMeshCache::Load(UserFiles[0], Batches))
+    {
+        SpawnMeshBatches(World, Batches);
+        UE_LOG(LogTemp, Log, TEXT("Mesh cache loaded, %d meshes spawned."), Batches.Num());
+    }
+    return FReply::Handled();
+}
+
+FReply ToolUI::OnBakeButtonClicked()
+{
+    TArray<FSVGMeshBatch> Batches;
+    CollectMeshBatches(Batches);
+    if (Batches.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Nothing to bake, extract SVG data first."));
+        return FReply::Handled();
+    }
+
+    // Pivot every asset on its own geometry so it can be placed and instanced anywhere.
+    for (FSVGMeshBatch& Batch : Batches)
+    {
+        const FBox Bounds = Batch.LODs[0].GetBounds().ShiftBy(Batch.Origin);
+        Batch.SetOrigin(FVector(Bounds.GetCenter().X, Bounds.GetCenter().Y, 0.f));
+    }
+
+    const TArray<UStaticMesh*> StaticMeshes = FSVGStaticMeshBaker::Bake(Batches, BakeSettings);
+    UE_LOG(LogTemp, Log, TEXT("Bake Button Clicked, %d static mesh assets created in %s."), StaticMeshes.Num(), *BakeSettings.PackagePath);
+    return FReply::Handled();
+}
+
+void ToolUI::CollectMeshBatches(TArray<FSVGMeshBatch>& OutBatches)
+{
+    OutBatches.Reset();
+
+    // Stroke ribbons are built up front so each one can join its element's batch.
+    // Reserved so pointers into it stay valid while batches are grouped.
+    TArray<FSVGElements> StrokeRibbons;
+    StrokeRibbons.Reserve(ParsedSVGElements.Num());
+
+    // Every fill's outline at each LOD level, simplified up front so shared edges can be
+    // found among the outlines each level actually keeps.
+    TArray<TArray<FSVGElements>> FillLevels;
+
+    // Group the elements first, one batch per element or one per grid cell holding
+    // the centre of the element's bounds. Batches refer to fills by their FillLevels index.
+    TArray<TArray<int32>> BatchFills;
+    TArray<TArray<const FSVGElements*>> BatchStrokes;
+    TMap<FIntPoint, int32> TileBatchIndices;
+
+    for (int32 ElementIndex = 0; ElementIndex < ParsedSVGElements.Num(); ElementIndex++)
+    {
+        FSVGElements& Elements = ParsedSVGElements[ElementIndex];
+        Trinangulation(Elements);
+
+        // Open outlines only ever render as strokes.
+        const bool bFill = Elements.bFilled && FSVGStroker::IsClosedOutline(Elements);
+        const FSVGElements* Stroke = nullptr;
+        if (bGenerateStrokes && Elements.StrokeWidth > 0.f)
+        {
+            FSVGElements Ribbon;
+            if (FSVGStroker::Stroke(Elements, Ribbon))
+            {
+                Stroke = &StrokeRibbons.Add_GetRef(MoveTemp(Ribbon));
+            }
+        }
+        if (!bFill && !Stroke)
+        {
+            continue;
+        }
+
+        int32 BatchIndex = OutBatches.Num();
+        if (!bTileOutput)
+        {
+            FSVGMeshBatch& Batch = OutBatches.AddDefaulted_GetRef();
+            Batch.Name = FString::Printf(TEXT("SVG_%s_%d"), *Elements.ElementType, ElementIndex);
+            BatchFills.AddDefaulted();
+            BatchStrokes.AddDefaulted();
+        }
+        else
+        {
+            const FVector2D Center = FBox2D(Elements.Vertices).GetCenter();
+            const FIntPoint Cell(FMath::FloorToInt(Center.X / TileSize), FMath::FloorToInt(Center.Y / TileSize));
+            if (const int32* TileBatchIndex = TileBatchIndices.Find(Cell))
+            {
+                BatchIndex = *TileBatchIndex;
+            }
+            else
+            {
+                TileBatchIndices.Add(Cell, BatchIndex);
+                FSVGMeshBatch& Batch = OutBatches.AddDefaulted_GetRef();
+                Batch.Name = FString::Printf(TEXT("SVGTile_%d_%d"), Cell.X, Cell.Y);
+                Batch.bTile = true;
+                BatchFills.AddDefaulted();
+                BatchStrokes.AddDefaulted();
+            }
+        }
+
+        if (bFill)
+        {
+            BatchFills[BatchIndex].Add(FillLevels.Num());
+            BuildLODOutlines(Elements, NumLODs, FillLevels.AddDefaulted_GetRef());
+        }
+        if (Stroke)
+        {
+            BatchStrokes[BatchIndex].Add(Stroke);
+        }
+    }
+
+    // Hidden walls are found across all fills, whatever batch they end up in, so elements
+    // touching across tile boundaries or spawned as separate actors lose their shared walls too.
+    TArray<TSet<FSVGEdgeKey>> InternalEdges;
+    if (bCullInternalFaces && FillLevels.Num() > 1)
+    {
+        InternalEdges.SetNum(NumLODs);
+        for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+        {
+            TArray<const TArray<FVector2D>*> Outlines;
+            Outlines.Reserve(FillLevels.Num());
+            for (const TArray<FSVGElements>& Levels : FillLevels)
+            {
+                Outlines.Add(&Levels[LODIndex].Vertices);
+            }
+            FSVGOutline::FindInternalEdges(Outlines, InternalEdges[LODIndex]);
+        }
+    }
+    const int32 NumCulledWalls = InternalEdges.Num() > 0 ? InternalEdges[0].Num() * 2 : 0;
+
+    int32 NumWeldedVertices = 0;
+    for (int32 BatchIndex = 0; BatchIndex < OutBatches.Num(); BatchIndex++)
+    {
+        FSVGMeshBatch& Batch = OutBatches[BatchIndex];
+
+        Batch.LODs.SetNum(NumLODs);
+        auto AppendLODChain = [this, &Batch](const TArray<FSVGElements>& Levels, const TArray<TSet<FSVGEdgeKey>>* LevelInternalEdges)
+        {
+            TArray<FSVGMeshData> LODs;
+            if (BuildLODChain(Levels, LODs, LevelInternalEdges))
+            {
+                for (int32 LODIndex = 0; LODIndex < LODs.Num(); LODIndex++)
+                {
+                    Batch.LODs[LODIndex].Append(LODs[LODIndex]);
+                }
+            }
+        };
+        for (int32 FillIndex : BatchFills[BatchIndex])
+        {
+            AppendLODChain(FillLevels[FillIndex], InternalEdges.Num() > 0 ? &InternalEdges : nullptr);
+        }
+        // Strokes are painted over fills, and their walls never touch a neighbour's.
+        for (const FSVGElements* Stroke : BatchStrokes[BatchIndex])
+        {
+            TArray<FSVGElements> StrokeLevels;
+            BuildLODOutlines(*Stroke, NumLODs, StrokeLevels);
+            AppendLODChain(StrokeLevels, nullptr);
+        }
+
+        if (InternalEdges.Num() > 0 && BatchFills[BatchIndex].Num() > 1)
+        {
+            // Neighbouring elements merged into one batch duplicate their shared cap corners.
+            for (FSVGMeshData& LOD : Batch.LODs)
+            {
+                NumWeldedVertices += LOD.WeldVertices();
+            }
+        }
+    }
+
+    OutBatches.RemoveAll([](const FSVGMeshBatch& Batch) { return Batch.LODs[0].IsEmpty(); });
+
+    if (bTileOutput)
+    {
+        // Give each tile a local origin at the centre of its top face so the
+        // component bounds stay tight and vertex positions stay small.
+        for (FSVGMeshBatch& Batch : OutBatches)
+        {
+            const FBox Bounds = Batch.LODs[0].GetBounds();
+            Batch.SetOrigin(FVector(Bounds.GetCenter().X, Bounds.GetCenter().Y, 0.f));
+        }
+    }
+
+    if (bCullInternalFaces)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Culled %d internal walls and welded %d vertices."), NumCulledWalls, NumWeldedVertices);
+    }
+}
+
+void ToolUI::BuildLODOutlines(const FSVGElements& Elements, int32 NumLevels, TArray<FSVGElements>& OutLevels)
+{
+    OutLevels.Reset(NumLevels);
+    OutLevels.Add(Elements);
+
+    const bool bCanSimplify = CanSimplify(Elements);
+    for (int32 LODIndex = 1; LODIndex < NumLevels; LODIndex++)
+    {
+        FSVGElements Previous = OutLevels.Last();
+        FSVGElements& LevelElements = OutLevels.Add_GetRef(MoveTemp(Previous));
+        if (!bCanSimplify)
+        {
+            continue;
+        }
+
+        // Always measured against the full detail outline.
+        const int32 PreviousNumVertices = LevelElements.Vertices.Num();
+        FSVGOutline::Simplify(Elements.Vertices, GetLODTolerance(LODIndex), LevelElements.Vertices);
+        if (LevelElements.Vertices.Num() != PreviousNumVertices &&
+            LevelElements.ElementType.Equals(TEXT("polygon"), ESearchCase::IgnoreCase))
+        {
+            // Re-fan the caps over the simplified outline.
+            Trinangulation(LevelElements);
+        }
+    }
+}
+
+bool ToolUI::BuildLODChain(const TArray<FSVGElements>& Levels, TArray<FSVGMeshData>& OutLODs, const TArray<TSet<FSVGEdgeKey>>* LevelInternalEdges)
+{
+    OutLODs.Reset(Levels.Num());
+    for (int32 LODIndex = 0; LODIndex < Levels.Num(); LODIndex++)
+    {
+        const TSet<FSVGEdgeKey>* InternalEdges = LevelInternalEdges ? &(*LevelInternalEdges)[LODIndex] : nullptr;
+
+        // Neighbours may have dropped a shared edge even where this outline is unchanged,
+        // so levels are only repeated when there is nothing to cull.
+        if (LODIndex > 0 && !InternalEdges && Levels[LODIndex].Vertices.Num() == Levels[LODIndex - 1].Vertices.Num())
+        {
+            FSVGMeshData Previous = OutLODs.Last();
+            OutLODs.Add(MoveTemp(Previous));
+            continue;
+        }
+
+        if (!BuildExtrudedMesh(Levels[LODIndex], OutLODs.AddDefaulted_GetRef(), InternalEdges) && LODIndex == 0)
+        {
+            OutLODs.Reset();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ToolUI::CanSimplify(const FSVGElements& Elements)
+{
+    // Rects are already minimal, only curved and free-form outlines are simplified.
+    return Elements.ElementType.Equals(TEXT("circle"), ESearchCase::IgnoreCase) ||
+        Elements.ElementType.Equals(TEXT("polygon"), ESearchCase::IgnoreCase);
+}
+
+float ToolUI::GetLODTolerance(int32 LODIndex) const
+{
+    // Tolerance doubles per level.
+    return LODTolerance * FMath::Pow(2.0f, LODIndex - 1);
+}
+
+void ToolUI::RefreshPreview(bool bOnlySimplified)
 {
-    for (FSVGElements& Elements : ParsedSVGElements)
+    if (!PreviewWidget.IsValid())
+    {
+        return;
+    }
+
+    if (!bOnlySimplified)
     {
-        if (Elements.ElementType.Equals(TEXT("rect"), ESearchCase::IgnoreCase))
+        PreviewWidget->ResetElements(ParsedSVGElements.Num());
+        PreviewElement = INDEX_NONE;
+
+        // Strokes are never simplified, so their ribbons only change with the elements themselves.
+        PreviewStrokeMeshes.Reset();
+        PreviewStrokeMeshes.SetNum(ParsedSVGElements.Num());
+    }
+
+    const int32 LODIndex = FMath::Min(PreviewLOD, NumLODs - 1);
+    for (int32 ElementIndex = 0; ElementIndex < ParsedSVGElements.Num(); ElementIndex++)
+    {
+        FSVGElements& Elements = ParsedSVGElements[ElementIndex];
+        if (bOnlySimplified && !CanSimplify(Elements))
+        {
+            continue;
+        }
+
+        if (!bOnlySimplified)
         {
-            // Compute the flat vertices (2D) for the rectangle.
             Trinangulation(Elements);
 
-            // Expecting Elements.Vertices to hold your 4 2D corner points.
-            // Create vertices for the top face (z = 0) and bottom face (z = -ExtrusionDepth).
-            TArray<FVector> Vertices;
-            for (const FVector2D& Vec2D : Elements.Vertices)
-            {
-                // Top face vertex
-                Vertices.Add(FVector(Vec2D.X, Vec2D.Y, 0.f));
-            }
-            for (const FVector2D& Vec2D : Elements.Vertices)
+            FSVGElements Ribbon;
+            if (bGenerateStrokes && Elements.StrokeWidth > 0.f && FSVGStroker::Stroke(Elements, Ribbon))
             {
-                // Bottom face vertex (offset in negative z)
-                Vertices.Add(FVector(Vec2D.X, Vec2D.Y, -ExtrusionDepth));
+                BuildExtrudedMesh(Ribbon, PreviewStrokeMeshes[ElementIndex]);
             }
+        }
 
-            // Define triangle indices.
-            // Assuming Elements.Vertices originally has 4 points in order:
-            // Top face: indices 0,1,2,3; Bottom face: indices 4,5,6,7.
+        // Same outline as Generate gives this level.
+        FSVGMeshData Mesh;
+        if (Elements.bFilled && FSVGStroker::IsClosedOutline(Elements))
+        {
+            TArray<FSVGElements> Levels;
+            BuildLODOutlines(Elements, LODIndex + 1, Levels);
+            BuildExtrudedMesh(Levels[LODIndex], Mesh);
+        }
 
-            TArray<int32> Triangles;
-            // Top face 
-            Triangles.Append({ 0, 2, 1, 0, 3, 2 });
-            // Bottom face (reverse order so the normals face the opposite way):
-            Triangles.Append({ 4, 5, 6, 4, 6, 7 });
+        // Kept as separate meshes, the preview finds each one's top cap from its vertex layout.
+        PreviewWidget->SetElementMesh(ElementIndex, { &Mesh, &PreviewStrokeMeshes[ElementIndex] });
+    }
+}
 
-            // Side faces:
-            
-            Triangles.Append({ 0, 1, 5, 0, 5, 4 }); //side 1, 0-1 edge
-            
-            Triangles.Append({ 1, 2, 6, 1, 6, 5 });  // Side 2, 1-2 edge
-           
-            Triangles.Append({ 2, 3, 7, 2, 7, 6 });  // Side 3, 2-3 edge
-          
-            Triangles.Append({ 3, 0, 4, 3, 4, 7 });   // Side 4, edge 3-4
-
-            FActorSpawnParameters SpawnParameters;
-            UWorld* World = GWorld;
-            if (!World)
-            {
-                UE_LOG(LogTemp, Error, TEXT("World not found."));
-                return FReply::Handled();
-            }
-            AMyMeshActor* MeshActor = World->SpawnActor<AMyMeshActor>(AMyMeshActor::StaticClass(), FTransform::Identity, SpawnParameters);
-            if (MeshActor)
-            {
-                MeshActor->CreateMesh(Vertices, Triangles);
-            }
+void ToolUI::CreateMeshLODs(AMyMeshActor* MeshActor, const TArray<FSVGMeshData>& LODs)
+{
+    if (LODs.Num() == 1)
+    {
+        MeshActor->CreateMesh(LODs[0].Vertices, LODs[0].Triangles, LODs[0].Colors);
+    }
+    else
+    {
+        for (int32 LODIndex = 0; LODIndex < LODs.Num(); LODIndex++)
+        {
+            MeshActor->CreateMeshLOD(LODIndex, LODs[LODIndex].Vertices, LODs[LODIndex].Triangles, LODs[LODIndex].Colors, FSVGMeshBatch::GetLODScreenSize(LODIndex));
         }
-        // for a circle
-        else if (Elements.ElementType.Equals(TEXT("circle"), ESearchCase::IgnoreCase))
+    }
+    MeshActor->SetMeshMaterial(FSVGVertexColorMaterial::Get());
+}
+
+bool ToolUI::BuildExtrudedMesh(const FSVGElements& Elements, FSVGMeshData& OutMesh, const TSet<FSVGEdgeKey>* InternalEdges)
+{
+    OutMesh.Vertices.Reset();
+    OutMesh.Triangles.Reset();
+
+    // Side walls along edges shared with a neighbouring element are never visible.
+    auto IsInternalEdge = [InternalEdges](const FVector2D& Start, const FVector2D& End)
+    {
+        return InternalEdges && InternalEdges->Contains(FSVGEdgeKey(Start, End));
+    };
+
+    // Every vertex carries the fill, so elements of any colour can share one material and section.
+    const FColor VertexColor = Elements.FillColor.ToFColor(true);
+
+    if (Elements.ElementType.Equals(TEXT("rect"), ESearchCase::IgnoreCase))
+    {
+        // Expecting Elements.Vertices to hold the 4 2D corner points.
+        if (Elements.Vertices.Num() != 4)
         {
-            Trinangulation(Elements); //approcimate circle with 32 segments
-           const int32 NumPoints = Elements.Vertices.Num();
-            if (NumPoints < 3)
-            {
-                UE_LOG(LogTemp, Error, TEXT("Not enough vertices for circle"));
-                return FReply::Handled();
-            }
-            
-            float Extrusion = ExtrusionDepth;
-            float cx = Elements.Parameters[0];              // Generate top/bottom faces and connect with side triangles
-                                                            // Central vertex for top/bottom faces improves triangulation
-            float cy = Elements.Parameters[1];
+            UE_LOG(LogTemp, Error, TEXT("Not enough vertices for rectangle"));
+            return false;
+        }
 
-            TArray<FVector2D> TopFace;
-            TopFace.Add(FVector2d(cx, cy));
-            TopFace.Append(Elements.Vertices);
+        // Create vertices for the top face (z = 0) and bottom face (z = -ExtrusionDepth).
+        TArray<FVector>& Vertices = OutMesh.Vertices;
+        for (const FVector2D& Vec2D : Elements.Vertices)
+        {
+            // Top face vertex
+            Vertices.Add(FVector(Vec2D.X, Vec2D.Y, 0.f));
+        }
+        for (const FVector2D& Vec2D : Elements.Vertices)
+        {
+            // Bottom face vertex (offset in negative z)
+            Vertices.Add(FVector(Vec2D.X, Vec2D.Y, -ExtrusionDepth));
+        }
 
-            int32 TopCount = TopFace.Num();
-            TArray<FVector> Vertices3D;
-            
-            for (const FVector2D& Vec2D : TopFace)
-            {
-                Vertices3D.Add(FVector(Vec2D.X, Vec2D.Y, 0.f));
-            }
-            
-            //bottom face
-            const int32 BottomOffset = TopCount;
-            for (const FVector2D& Vec2D : TopFace)
-            {
-                Vertices3D.Add(FVector(Vec2D.X, Vec2D.Y, -Extrusion));
-            }
-            TArray<int32> Triangles;
-           
-            for (int32 i = 1; i < TopCount - 1; i++)
-            {
-                //top
-                Triangles.Append({0, i, i+1});
-                
-            }
-            Triangles.Append({ 0, TopCount - 1, 1});
-          
-            for (int32 i = 1; i < TopCount - 1; i++)
-            {
-                Triangles.Append({BottomOffset, BottomOffset + i + 1, BottomOffset + i});
-            }
-            Triangles.Append({BottomOffset, BottomOffset + 1 , BottomOffset + TopCount - 1});
+        // Define triangle indices.
+        // Top face: indices 0,1,2,3; Bottom face: indices 4,5,6,7.
 
-            for (int32 i = 1; i < TopCount; i++)
-            {
-                int32 nextIndex = (i == TopCount - 1) ? 1 : i + 1;
-                int32 TopA = i;
-                int32 TopB = nextIndex;
-                int32 bottomA = BottomOffset + i;
-                int32 bottomB = BottomOffset + nextIndex;
+        TArray<int32>& Triangles = OutMesh.Triangles;
+        // Top face 
+        Triangles.Append({ 0, 2, 1, 0, 3, 2 });
+        // Bottom face (reverse order so the normals face the opposite way):
+        Triangles.Append({ 4, 5, 6, 4, 6, 7 });
 
-                Triangles.Append({TopA, bottomA, TopB});
-                Triangles.Append({TopB, bottomA, bottomB});
-            }
-            UWorld* World = GWorld;
-            if (!World)
-            {
-                UE_LOG(LogTemp, Error, TEXT("World not found."));
-                return FReply::Handled();
-            }
-            FActorSpawnParameters SpawnParameters;
-            AMyMeshActor* MeshActor = World ->SpawnActor<AMyMeshActor>(AMyMeshActor::StaticClass(), FTransform::Identity, SpawnParameters);
-            if (MeshActor)
+        // Side faces, one per edge i -> i+1:
+        for (int32 i = 0; i < 4; i++)
+        {
+            const int32 Next = (i + 1) % 4;
+            if (IsInternalEdge(Elements.Vertices[i], Elements.Vertices[Next]))
             {
-                MeshActor->CreateMesh(Vertices3D, Triangles);
+                continue;
             }
+            Triangles.Append({ i, Next, 4 + Next, i, 4 + Next, 4 + i });
         }
-        // for polygons
-        else if (Elements.ElementType.Equals(TEXT("polygon"), ESearchCase::IgnoreCase))
+        OutMesh.Colors.Init(VertexColor, OutMesh.Vertices.Num());
+        return true;
+    }
+    // for a circle
+    else if (Elements.ElementType.Equals(TEXT("circle"), ESearchCase::IgnoreCase))
+    {
+        const int32 NumPoints = Elements.Vertices.Num();
+        if (NumPoints < 3 || Elements.Parameters.Num() < 2)
         {
-            Trinangulation(Elements);
-            const int32 NumVertices = Elements.Vertices.Num();
-            if (NumVertices < 3)
-            {
-                UE_LOG(LogTemp, Error, TEXT("Not enough vertices for Polygon"));
-                return FReply::Handled();
-            }
-            TArray<FVector> Vert3D;
-            // top fave z = 0
-            for (const FVector2d& Vec2D : Elements.Vertices)
-            {
-                Vert3D.Add(FVector(Vec2D.X, Vec2D.Y, 0.f));
-            }
+            UE_LOG(LogTemp, Error, TEXT("Not enough vertices for circle"));
+            return false;
+        }
+        
+        float Extrusion = ExtrusionDepth;
+        float cx = Elements.Parameters[0];              // Generate top/bottom faces and connect with side triangles
+                                                        // Central vertex for top/bottom faces improves triangulation
+        float cy = Elements.Parameters[1];
 
-            const int32 BottomOffset = NumVertices;
-            for (const FVector2D& Vec2D : Elements.Vertices)
-            {
-                Vert3D.Add(FVector(Vec2D.X, Vec2D.Y, -ExtrusionDepth));
-            }
-            TArray<int32> Triangles;
-            for (int32 i = 0; i < Elements.Triangles.Num(); i+= 3)
-            {
-                Triangles.Append({Elements.Triangles[i], Elements.Triangles[i + 1], Elements.Triangles[i + 2]});
-            }
+        TArray<FVector2D> TopFace;
+        TopFace.Add(FVector2d(cx, cy));
+        TopFace.Append(Elements.Vertices);
+
+        int32 TopCount = TopFace.Num();
+        TArray<FVector>& Vertices3D = OutMesh.Vertices;
+        
+        for (const FVector2D& Vec2D : TopFace)
+        {
+            Vertices3D.Add(FVector(Vec2D.X, Vec2D.Y, 0.f));
+        }
+        
+        //bottom face
+        const int32 BottomOffset = TopCount;
+        for (const FVector2D& Vec2D : TopFace)
+        {
+            Vertices3D.Add(FVector(Vec2D.X, Vec2D.Y, -Extrusion));
+        }
+        TArray<int32>& Triangles = OutMesh.Triangles;
+       
+        for (int32 i = 1; i < TopCount - 1; i++)
+        {
+            //top
+            Triangles.Append({0, i, i+1});
+            
+        }
+        Triangles.Append({ 0, TopCount - 1, 1});
+      
+        for (int32 i = 1; i < TopCount - 1; i++)
+        {
+            Triangles.Append({BottomOffset, BottomOffset + i + 1, BottomOffset + i});
+        }
+        Triangles.Append({BottomOffset, BottomOffset + 1 , BottomOffset + TopCount - 1});
 
-            for (int32 i = 0; i < Elements.Triangles.Num(); i+= 3)
+        for (int32 i = 1; i < TopCount; i++)
+        {
+            int32 nextIndex = (i == TopCount - 1) ? 1 : i + 1;
+            if (IsInternalEdge(TopFace[i], TopFace[nextIndex]))
             {
-                Triangles.Append({BottomOffset + Elements.Triangles[i], BottomOffset + Elements.Triangles[i+2], BottomOffset + Elements.Triangles[i + 1]});
+                continue;
             }
-            for (int32 i = 0; i < NumVertices; i++)
+            int32 TopA = i;
+            int32 TopB = nextIndex;
+            int32 bottomA = BottomOffset + i;
+            int32 bottomB = BottomOffset + nextIndex;
+
+            Triangles.Append({TopA, bottomA, TopB});
+            Triangles.Append({TopB, bottomA, bottomB});
+        }
+        OutMesh.Colors.Init(VertexColor, OutMesh.Vertices.Num());
+        return true;
+    }
+    // for polygons, and stroke ribbons which are polygons with an optional hole
+    else if (Elements.ElementType.Equals(TEXT("polygon"), ESearchCase::IgnoreCase) ||
+        Elements.ElementType.Equals(TEXT("stroke"), ESearchCase::IgnoreCase))
+    {
+        const int32 NumVertices = Elements.Vertices.Num();
+        if (NumVertices < 3)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Not enough vertices for Polygon"));
+            return false;
+        }
+
+        // Strokes sit just proud of the fill they outline so the overlapping caps don't z-fight.
+        const float Lift = Elements.ElementType.Equals(TEXT("stroke"), ESearchCase::IgnoreCase) ? StrokeLift : 0.f;
+
+        TArray<FVector>& Vert3D = OutMesh.Vertices;
+        Vert3D.Reserve(NumVertices * 2);
+        // top fave z = 0
+        for (const FVector2d& Vec2D : Elements.Vertices)
+        {
+            Vert3D.Add(FVector(Vec2D.X, Vec2D.Y, Lift));
+        }
+
+        const int32 BottomOffset = NumVertices;
+        for (const FVector2D& Vec2D : Elements.Vertices)
+        {
+            Vert3D.Add(FVector(Vec2D.X, Vec2D.Y, -ExtrusionDepth - Lift));
+        }
+        TArray<int32>& Triangles = OutMesh.Triangles;
+        for (int32 i = 0; i < Elements.Triangles.Num(); i+= 3)
+        {
+            Triangles.Append({Elements.Triangles[i], Elements.Triangles[i + 1], Elements.Triangles[i + 2]});
+        }
+
+        for (int32 i = 0; i < Elements.Triangles.Num(); i+= 3)
+        {
+            Triangles.Append({BottomOffset + Elements.Triangles[i], BottomOffset + Elements.Triangles[i+2], BottomOffset + Elements.Triangles[i + 1]});
+        }
+        // Walls run around each boundary loop, wrapping within the loop.
+        const int32 NumContours = FMath::Max(1, Elements.ContourStarts.Num());
+        for (int32 Contour = 0; Contour < NumContours; Contour++)
+        {
+            const int32 ContourStart = Elements.ContourStarts.IsValidIndex(Contour) ? Elements.ContourStarts[Contour] : 0;
+            const int32 ContourEnd = Elements.ContourStarts.IsValidIndex(Contour + 1) ? Elements.ContourStarts[Contour + 1] : NumVertices;
+            for (int32 i = ContourStart; i < ContourEnd; i++)
             {
-                int32 nextIndex = (i + 1) % NumVertices; // Wrap around to the first vertex
+                int32 nextIndex = i + 1 < ContourEnd ? i + 1 : ContourStart; // Wrap around to the first vertex
+                if (IsInternalEdge(Elements.Vertices[i], Elements.Vertices[nextIndex]))
+                {
+                    continue;
+                }
                 int32 topA = i;
                 int32 topB = nextIndex;
                 int32 bottomA = BottomOffset + i;
@@ -305,26 +1025,12 @@ FReply ToolUI::OnGenerateButtonClicked()
                 Triangles.Append({ topA, bottomA, topB }); // Side triangle 1
                 Triangles.Append({ topB, bottomA, bottomB }); // Side triangle 2
             }
-            UWorld* World = GWorld;
-            if (!World)
-            {
-                UE_LOG(LogTemp, Error, TEXT("World not found."));
-                return FReply::Handled();
-            }
-            FActorSpawnParameters SpawnParameters;
-            AMyMeshActor* MeshActor = World->SpawnActor<AMyMeshActor>(
-                AMyMeshActor::StaticClass(), FTransform::Identity, SpawnParameters);
-            if (MeshActor)
-            {
-                MeshActor->CreateMesh(Vert3D, Triangles);
-            }
-            
         }
-        
+        OutMesh.Colors.Init(VertexColor, OutMesh.Vertices.Num());
+        return true;
     }
-    
-    UE_LOG(LogTemp, Log, TEXT("Generate Button Clicked, extruded mesh created."));
-    return FReply::Handled();
+
+    return false;
 }
 
 FReply ToolUI::OnBrowseButtonClicked()
@@ -391,7 +1097,10 @@ FReply ToolUI::OnBrowseButtonClicked()
 
                     if (NodeTag.Equals(TEXT("rect"), ESearchCase::IgnoreCase) ||
                         NodeTag.Equals(TEXT("circle"), ESearchCase::IgnoreCase) ||
-                        NodeTag.Equals(TEXT("polygon"), ESearchCase::IgnoreCase))
+                        NodeTag.Equals(TEXT("polygon"), ESearchCase::IgnoreCase) ||
+                        NodeTag.Equals(TEXT("polyline"), ESearchCase::IgnoreCase) ||
+                        NodeTag.Equals(TEXT("line"), ESearchCase::IgnoreCase) ||
+                        NodeTag.Equals(TEXT("g"), ESearchCase::IgnoreCase))
                     {
                         bHasSupportedElement = true;
                         break; // Found a supported element, so the file is valid for our purposes.
@@ -503,23 +1212,61 @@ void ToolUI::ProcessSVGData(const FString& SVGData)
         return;
     }
 
-    const TArray<FXmlNode*>& ChildNodes = RootNode->GetChildrenNodes();
+    // Class rules may be declared anywhere in the document, so gather them before styling any element.
+    FSVGStyleSheet StyleSheet;
+    CollectStyleSheets(RootNode, StyleSheet);
+
+    FSVGStyle RootStyle;
+    RootStyle.Apply(RootNode, StyleSheet);
+    ProcessSVGChildren(RootNode, RootStyle, StyleSheet);
+
+    RefreshPreview();
+}
+
+void ToolUI::CollectStyleSheets(FXmlNode* Node, FSVGStyleSheet& OutStyleSheet)
+{
+    for (FXmlNode* Child : Node->GetChildrenNodes())
+    {
+        if (Child->GetTag().Equals(TEXT("style"), ESearchCase::IgnoreCase))
+        {
+            OutStyleSheet.Parse(Child->GetContent());
+        }
+        else
+        {
+            CollectStyleSheets(Child, OutStyleSheet);
+        }
+    }
+}
+
+void ToolUI::ProcessSVGChildren(FXmlNode* Parent, const FSVGStyle& ParentStyle, const FSVGStyleSheet& StyleSheet)
+{
+    const TArray<FXmlNode*>& ChildNodes = Parent->GetChildrenNodes();
     for (FXmlNode* Node : ChildNodes)
     {
         FString NodeTag = Node->GetTag();
         if (NodeTag.Equals(TEXT("rect"), ESearchCase::IgnoreCase) ||
             NodeTag.Equals(TEXT("circle"), ESearchCase::IgnoreCase) ||
-            NodeTag.Equals(TEXT("polygon"), ESearchCase::IgnoreCase))
+            NodeTag.Equals(TEXT("polygon"), ESearchCase::IgnoreCase) ||
+            NodeTag.Equals(TEXT("polyline"), ESearchCase::IgnoreCase) ||
+            NodeTag.Equals(TEXT("line"), ESearchCase::IgnoreCase))
+        {
+            ProcessSVGNode(Node, ParentStyle, StyleSheet);
+        }
+        // Groups pass their style down to everything inside them.
+        else if (NodeTag.Equals(TEXT("g"), ESearchCase::IgnoreCase))
         {
-            ProcessSVGNode(Node);
+            FSVGStyle GroupStyle = ParentStyle;
+            GroupStyle.Apply(Node, StyleSheet);
+            ProcessSVGChildren(Node, GroupStyle, StyleSheet);
         }
     }
 }
 
 
-void ToolUI::ProcessSVGNode(FXmlNode* Node)
+void ToolUI::ProcessSVGNode(FXmlNode* Node, const FSVGStyle& ParentStyle, const FSVGStyleSheet& StyleSheet)
 {
     FString NodeTag = Node->GetTag();
+    const int32 NumParsedBefore = ParsedSVGElements.Num();
     
     if (NodeTag.Equals(TEXT("rect"), ESearchCase::IgnoreCase))
     {
@@ -584,6 +1331,51 @@ void ToolUI::ProcessSVGNode(FXmlNode* Node)
         UE_LOG(LogTemp, Log, TEXT("Polygon Found with %d vertices"), PolygonElement.Vertices.Num());
         ParsedSVGElements.Add(PolygonElement);
     }
+    // Open shapes, only drawn through their stroke.
+    else if (NodeTag.Equals(TEXT("polyline"), ESearchCase::IgnoreCase))
+    {
+        FString Points = Node->GetAttribute(TEXT("points"));
+        TArray<FString> PointPairs;
+        Points.ParseIntoArray(PointPairs, TEXT(" "), true);
+
+        FSVGElements PolylineElement = FSVGElements(TEXT("polyline"));
+        for (const FString& Pair : PointPairs)
+        {
+            TArray<FString> Coordinates;
+            Pair.ParseIntoArray(Coordinates, TEXT(","), true);
+            if (Coordinates.Num() == 2)
+            {
+                float x = FCString::Atof(*Coordinates[0]);
+                float y = FCString::Atof(*Coordinates[1]);
+                PolylineElement.Vertices.Add(FVector2D(x, y));
+            }
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Polyline Found with %d vertices"), PolylineElement.Vertices.Num());
+        ParsedSVGElements.Add(PolylineElement);
+    }
+    else if (NodeTag.Equals(TEXT("line"), ESearchCase::IgnoreCase))
+    {
+        float x1 = FCString::Atof(*Node->GetAttribute(TEXT("x1")));
+        float y1 = FCString::Atof(*Node->GetAttribute(TEXT("y1")));
+        float x2 = FCString::Atof(*Node->GetAttribute(TEXT("x2")));
+        float y2 = FCString::Atof(*Node->GetAttribute(TEXT("y2")));
+
+        UE_LOG(LogTemp, Log, TEXT("Line Found: x1=%.2f, y1=%.2f, x2=%.2f, y2=%.2f"), x1, y1, x2, y2);
+
+        FSVGElements LineElement = FSVGElements(TEXT("line"));
+        LineElement.Vertices.Add(FVector2D(x1, y1));
+        LineElement.Vertices.Add(FVector2D(x2, y2));
+        ParsedSVGElements.Add(LineElement);
+    }
+
+    if (ParsedSVGElements.Num() > NumParsedBefore)
+    {
+        FSVGStyle Style = ParentStyle;
+        Style.Apply(Node, StyleSheet);
+
+        Style.ApplyTo(ParsedSVGElements.Last());
+    }
 }
 
 void ToolUI::Trinangulation(FSVGElements& Elements)
@@ -701,18 +1493,162 @@ void ToolUI::OnExtrusionDepthSliderChanged(float NewValue)
     ExtrusionDepthTextBox->SetText(FText::AsNumber(ExtrusionDepth));
 }
 
+ECheckBoxState ToolUI::GetTileOutputState() const
+{
+    return bTileOutput ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void ToolUI::OnTileOutputChanged(ECheckBoxState NewState)
+{
+    bTileOutput = (NewState == ECheckBoxState::Checked);
+}
+
+FText ToolUI::GetTileSizeText() const
+{
+    return FText::AsNumber(TileSize);
+}
+
+void ToolUI::OnTileSizeTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
+{
+    FString Text = InText.ToString();
+    if (Text.IsNumeric())
+    {
+        // A tile must have some extent, otherwise every element would land in its own cell.
+        TileSize = FMath::Max(FCString::Atof(*Text), 1.0f);
+    }
+}
+
+FText ToolUI::GetNumLODsText() const
+{
+    return FText::AsNumber(NumLODs);
+}
+
+void ToolUI::OnNumLODsTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
+{
+    FString Text = InText.ToString();
+    if (Text.IsNumeric())
+    {
+        NumLODs = FMath::Clamp(FCString::Atoi(*Text), 1, MaxLODs);
+        RefreshPreview(true);
+    }
+}
+
+FText ToolUI::GetLODToleranceText() const
+{
+    return FText::AsNumber(LODTolerance);
+}
+
+void ToolUI::OnLODToleranceTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
+{
+    FString Text = InText.ToString();
+    if (Text.IsNumeric())
+    {
+        LODTolerance = FMath::Max(FCString::Atof(*Text), 0.0f);
+        RefreshPreview(true);
+    }
+}
 
+ECheckBoxState ToolUI::GetMergeMeshesState() const
+{
+    return BakeSettings.bMergeMeshes ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void ToolUI::OnMergeMeshesChanged(ECheckBoxState NewState)
+{
+    BakeSettings.bMergeMeshes = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState ToolUI::GetBakeCollisionState() const
+{
+    return BakeSettings.bBuildCollision ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnBakeCollisionChanged(ECheckBoxState NewState)
+{
+    BakeSettings.bBuildCollision = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState ToolUI::GetBakeNaniteState() const
+{
+    return BakeSettings.bEnableNanite ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnBakeNaniteChanged(ECheckBoxState NewState)
+{
+    BakeSettings.bEnableNanite = (NewState == ECheckBoxState::Checked);
+}
 
+ECheckBoxState ToolUI::GetQuantizeCachePositionsState() const
+{
+    return bQuantizeCachePositions ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnQuantizeCachePositionsChanged(ECheckBoxState NewState)
+{
+    bQuantizeCachePositions = (NewState == ECheckBoxState::Checked);
+}
 
+ECheckBoxState ToolUI::GetCullInternalFacesState() const
+{
+    return bCullInternalFaces ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnCullInternalFacesChanged(ECheckBoxState NewState)
+{
+    bCullInternalFaces = (NewState == ECheckBoxState::Checked);
+}
 
+ECheckBoxState ToolUI::GetGenerateStrokesState() const
+{
+    return bGenerateStrokes ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnGenerateStrokesChanged(ECheckBoxState NewState)
+{
+    bGenerateStrokes = (NewState == ECheckBoxState::Checked);
+    RefreshPreview();
+}
 
+FText ToolUI::GetPreviewLODText() const
+{
+    return FText::AsNumber(PreviewLOD);
+}
 
+void ToolUI::OnPreviewLODTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
+{
+    FString Text = InText.ToString();
+    if (Text.IsNumeric())
+    {
+        PreviewLOD = FMath::Clamp(FCString::Atoi(*Text), 0, MaxLODs - 1);
+        RefreshPreview(true);
+    }
+}
 
+FText ToolUI::GetPreviewElementText() const
+{
+    return PreviewElement == INDEX_NONE ? FText::GetEmpty() : FText::AsNumber(PreviewElement);
+}
 
+void ToolUI::OnPreviewElementTextCommitted(const FText& InText, ETextCommit::Type CommitInfo)
+{
+    FString Text = InText.ToString();
+    PreviewElement = Text.IsNumeric() && ParsedSVGElements.IsValidIndex(FCString::Atoi(*Text)) ? FCString::Atoi(*Text) : INDEX_NONE;
+    if (PreviewWidget.IsValid())
+    {
+        PreviewWidget->SetSelectedElement(PreviewElement);
+    }
+}
 
+ECheckBoxState ToolUI::GetPreviewWireframeState() const
+{
+    return bPreviewWireframe ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
 
+void ToolUI::OnPreviewWireframeChanged(ECheckBoxState NewState)
+{
+    bPreviewWireframe = (NewState == ECheckBoxState::Checked);
+    if (PreviewWidget.IsValid())
+    {
+        PreviewWidget->SetShowWireframe(bPreviewWireframe);
+    }
+}
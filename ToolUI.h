@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "SVGElements.h"
+#include "SVGMeshData.h"
+#include "SVGStaticMeshBaker.h"
+#include "SVGStyle.h"
 #include "XmlFile.h"
 
 
@@ -21,14 +24,31 @@ private:
 	FReply OnConvertSVGButtonClicked();
 	FReply OnExtractSVGButtonClicked();
 	FReply OnParseCustomSVGButtonClicked();
+	FReply OnBakeButtonClicked();
+	FReply OnSaveMeshCacheButtonClicked();
+	FReply OnLoadMeshCacheButtonClicked();
 
 	TSharedPtr<STextBlock> ErrorTextBlock;
 	
 
 	void ProcessSVGData(const FString& SVGData);
-	void ProcessSVGNode(FXmlNode* Node);
+	void CollectStyleSheets(FXmlNode* Node, FSVGStyleSheet& OutStyleSheet);
+	void ProcessSVGChildren(FXmlNode* Parent, const FSVGStyle& ParentStyle, const FSVGStyleSheet& StyleSheet);
+	void ProcessSVGNode(FXmlNode* Node, const FSVGStyle& ParentStyle, const FSVGStyleSheet& StyleSheet);
 
 	void Trinangulation(FSVGElements& Elements);
+	// Extrudes an element whose outline was already computed by Trinangulation.
+	// Walls along InternalEdges are left out. Top cap vertices come first and the bottom cap
+	// repeats them in the second half, which the preview relies on to find the top cap.
+	bool BuildExtrudedMesh(const FSVGElements& Elements, FSVGMeshData& OutMesh, const TSet<FSVGEdgeKey>* InternalEdges = nullptr);
+	// The full detail outline followed by one simplified outline per extra LOD level, NumLevels in all.
+	void BuildLODOutlines(const FSVGElements& Elements, int32 NumLevels, TArray<FSVGElements>& OutLevels);
+	// Extrudes one mesh per level. LevelInternalEdges, when given, holds the walls to leave out at each level.
+	bool BuildLODChain(const TArray<FSVGElements>& Levels, TArray<FSVGMeshData>& OutLODs, const TArray<TSet<FSVGEdgeKey>>* LevelInternalEdges = nullptr);
+	// Extrudes every parsed element and groups the results per element or per tile.
+	void CollectMeshBatches(TArray<FSVGMeshBatch>& OutBatches);
+	void SpawnMeshBatches(class UWorld* World, const TArray<FSVGMeshBatch>& Batches);
+	static void CreateMeshLODs(class AMyMeshActor* MeshActor, const TArray<FSVGMeshData>& LODs);
 	// UI elements.
 	TSharedPtr<class SEditableTextBox> FilePathTextBox;
 	TSharedPtr<class SEditableTextBox> ExtractedSVGTextBox;
@@ -48,4 +68,69 @@ private:
 	void OnExtrusionDepthTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
 	float GetExtrusionDepthSliderValue() const;
 	void OnExtrusionDepthSliderChanged(float NewValue);
+
+	// Spatial tiling of generated geometry, in SVG units.
+	bool bTileOutput = false;
+	float TileSize = 1000.0f;
+
+	ECheckBoxState GetTileOutputState() const;
+	void OnTileOutputChanged(ECheckBoxState NewState);
+	FText GetTileSizeText() const;
+	void OnTileSizeTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
+
+	// Hidden wall culling between all touching elements, and vertex welding within a tile.
+	bool bCullInternalFaces = true;
+
+	ECheckBoxState GetCullInternalFacesState() const;
+	void OnCullInternalFacesChanged(ECheckBoxState NewState);
+
+	// Stroke ribbons, raised by StrokeLift above and below the extruded fills they outline.
+	bool bGenerateStrokes = true;
+	static constexpr float StrokeLift = 0.1f;
+
+	ECheckBoxState GetGenerateStrokesState() const;
+	void OnGenerateStrokesChanged(ECheckBoxState NewState);
+
+	// LOD chain generation. The tolerance is in SVG units for LOD 1.
+	static constexpr int32 MaxLODs = 4;
+	int32 NumLODs = 1;
+	float LODTolerance = 1.0f;
+
+	FText GetNumLODsText() const;
+	void OnNumLODsTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
+	FText GetLODToleranceText() const;
+	void OnLODToleranceTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
+	static bool CanSimplify(const FSVGElements& Elements);
+	float GetLODTolerance(int32 LODIndex) const;
+
+	// Top-down preview of one LOD level. It is rebuilt element by element from the same
+	// extrusion as Generate, and never spawns into the world.
+	TSharedPtr<class SSVGPreview> PreviewWidget;
+	int32 PreviewLOD = 0;
+	int32 PreviewElement = INDEX_NONE;
+	bool bPreviewWireframe = false;
+	TArray<FSVGMeshData> PreviewStrokeMeshes;
+
+	// Rebuilds every element's preview, or with bOnlySimplified just those the LOD settings change.
+	void RefreshPreview(bool bOnlySimplified = false);
+	FText GetPreviewLODText() const;
+	void OnPreviewLODTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
+	FText GetPreviewElementText() const;
+	void OnPreviewElementTextCommitted(const FText& InText, ETextCommit::Type CommitInfo);
+	ECheckBoxState GetPreviewWireframeState() const;
+	void OnPreviewWireframeChanged(ECheckBoxState NewState);
+
+	FSVGBakeSettings BakeSettings;
+
+	ECheckBoxState GetMergeMeshesState() const;
+	void OnMergeMeshesChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBakeCollisionState() const;
+	void OnBakeCollisionChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBakeNaniteState() const;
+	void OnBakeNaniteChanged(ECheckBoxState NewState);
+
+	bool bQuantizeCachePositions = true;
+
+	ECheckBoxState GetQuantizeCachePositionsState() const;
+	void OnQuantizeCachePositionsChanged(ECheckBoxState NewState);
 };